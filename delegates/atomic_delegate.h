@@ -0,0 +1,154 @@
+#ifndef ATOMIC_DELEGATE_H
+#define ATOMIC_DELEGATE_H
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+//compact delegate that could be rebound by one thread while other threads call it
+
+/******************************************************************************************************************************/
+/* 'delegates::atomic_delegate<return_type(param_type1, param_type2)>' holds 'compact_delegate<return_type, ...>'             */
+/* (object pointer and code pointer) under a sequence lock:                                                                   */
+/*                                                                                                                            */
+/*   atomic_delegate<void(int)> handler(compact_delegate<void, int>(&old_handler, &Handler::on_value));                       */
+/*                                                                                                                            */
+/*   handler(42); // any thread                                                                                               */
+/*   handler.store(compact_delegate<void, int>(&new_handler, &Handler::on_value)); // any thread                              */
+/*                                                                                                                            */
+/* 'load' (and the call) reads both pointers and the sequence number with plain loads and no stores, so readers do not        */
+/* contend with each other; it retries only if a 'store' was made while it was reading, and never sees the object of one      */
+/* binding with the code of another. 'store' is serialized between writers by the sequence number itself.                     */
+/* The previous target must stay valid until calls that could have loaded it are done.                                        */
+/* Requires C++11.                                                                                                            */
+/*                                                                                                                            */
+/******************************************************************************************************************************/
+
+#include "compact_delegate.h"
+
+#if DELEGATES_CPLUSPLUS < 201103L
+#error "atomic_delegate requires C++11"
+#else
+
+#include <atomic>
+
+namespace delegates
+{
+	template<class ReturnT, class... ParamsT>
+	class atomic_delegate<ReturnT(ParamsT...)>
+	{
+	public:
+		typedef atomic_delegate type;
+		typedef compact_delegate<ReturnT, ParamsT...> delegate_type;
+
+	private:
+		typedef typename delegate_type::thunk_type thunk_type;
+
+	public:
+		atomic_delegate()
+			: m_sequence(0),
+			m_pthis(NULL),
+			m_thunk(NULL)
+		{ }
+
+		atomic_delegate(const delegate_type &delegate_to_store)
+			: m_sequence(0),
+			m_pthis(delegate_to_store.m_pthis),
+			m_thunk(delegate_to_store.m_thunk)
+		{ }
+
+		delegate_type load() const
+		{
+			for(;;)
+			{
+				const unsigned sequence = m_sequence.load(std::memory_order_acquire);
+				if(sequence & 1) // store in progress
+					continue;
+
+				void *pthis = m_pthis.load(std::memory_order_relaxed);
+				thunk_type thunk = m_thunk.load(std::memory_order_relaxed);
+
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if(m_sequence.load(std::memory_order_relaxed) == sequence)
+					return delegate_type(thunk, pthis);
+			}
+		}
+
+		void store(const delegate_type &delegate_to_store)
+		{
+			const unsigned sequence = begin_store();
+			m_pthis.store(delegate_to_store.m_pthis, std::memory_order_relaxed);
+			m_thunk.store(delegate_to_store.m_thunk, std::memory_order_relaxed);
+			end_store(sequence);
+		}
+
+		delegate_type exchange(const delegate_type &delegate_to_store)
+		{
+			const unsigned sequence = begin_store();
+			const delegate_type previous(m_thunk.load(std::memory_order_relaxed), m_pthis.load(std::memory_order_relaxed));
+			m_pthis.store(delegate_to_store.m_pthis, std::memory_order_relaxed);
+			m_thunk.store(delegate_to_store.m_thunk, std::memory_order_relaxed);
+			end_store(sequence);
+			return previous;
+		}
+
+		atomic_delegate& operator=(const delegate_type &delegate_to_store)
+		{
+			store(delegate_to_store);
+			return *this;
+		}
+
+		operator delegate_type() const
+		{
+			return load();
+		}
+
+		template<class... ArgsT>
+		inline ReturnT operator()(ArgsT&&... args) const
+		{
+			return load()(std::forward<ArgsT>(args)...);
+		}
+
+		inline bool empty() const
+		{
+			return NULL == m_thunk.load(std::memory_order_relaxed);
+		}
+
+		void clear()
+		{
+			store(delegate_type());
+		}
+
+	private:
+		std::atomic<unsigned> m_sequence; // odd while a store is in progress
+		std::atomic<void*> m_pthis;
+		std::atomic<thunk_type> m_thunk;
+
+		atomic_delegate(const atomic_delegate&);
+		void operator=(const atomic_delegate&);
+
+		// makes the sequence number odd (waiting for other writers), returns its previous value
+		unsigned begin_store()
+		{
+			unsigned sequence = m_sequence.load(std::memory_order_relaxed);
+			for(;;)
+			{
+				if(!(sequence & 1) &&
+					m_sequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire, std::memory_order_relaxed))
+					break;
+				sequence = m_sequence.load(std::memory_order_relaxed);
+			}
+			// the odd sequence number must be visible before the pointers change
+			std::atomic_thread_fence(std::memory_order_release);
+			return sequence;
+		}
+
+		void end_store(unsigned sequence)
+		{
+			m_sequence.store(sequence + 2, std::memory_order_release);
+		}
+	};
+}
+
+#endif // DELEGATES_CPLUSPLUS < 201103L
+
+#endif // ATOMIC_DELEGATE_H
@@ -0,0 +1,100 @@
+#ifndef BIND_FRONT_H
+#define BIND_FRONT_H
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+//partial application: one or two leading arguments are stored together with the callable, no context objects needed
+
+/******************************************************************************************************************************/
+/* 'delegates::bind_front(target, bound1)' and 'delegates::bind_front(target, bound1, bound2)' return 'front_binder' holding  */
+/* copies of the target (function pointer, 'delegate', 'compact_delegate', functor) and of the bound arguments by value,      */
+/* calling it passes the bound arguments first:                                                                               */
+/*                                                                                                                            */
+/*   void on_data(int connection_id, const char *data, size_t size);                                                          */
+/*                                                                                                                            */
+/*   inplace_delegate<void(const char*, size_t)> d = delegates::bind_front(&on_data, connection_id);                          */
+/*                                                                                                                            */
+/* 'front_binder' has no members besides the target and the arguments, so it is trivially copyable when they are and          */
+/* 'inplace_delegate' stores and copies it with no heap allocation or manager calls. Bound arguments are passed to the target */
+/* as const lvalues. Call 'bind_front' qualified: 'std::bind_front' could be found by argument dependent lookup with C++20.   */
+/* Requires C++11.                                                                                                            */
+/*                                                                                                                            */
+/******************************************************************************************************************************/
+
+#include "delegate.h"
+
+#if DELEGATES_CPLUSPLUS < 201103L
+#error "bind_front requires C++11"
+#else
+
+namespace delegates
+{
+	template<class TargetT, class Bound1T, class Bound2T = detail::DefaultVoid>
+	class front_binder
+	{
+	public:
+		typedef front_binder type;
+
+		front_binder(const TargetT &target, const Bound1T &bound1, const Bound2T &bound2)
+			: m_target(target),
+			m_bound1(bound1),
+			m_bound2(bound2)
+		{ }
+
+		template<class... ArgsT>
+		inline auto operator()(ArgsT&&... args) const
+			-> decltype(std::declval<const TargetT&>()(std::declval<const Bound1T&>(), std::declval<const Bound2T&>(), std::forward<ArgsT>(args)...))
+		{
+			return m_target(m_bound1, m_bound2, std::forward<ArgsT>(args)...);
+		}
+
+	private:
+		TargetT m_target;
+		Bound1T m_bound1;
+		Bound2T m_bound2;
+	};
+
+	template<class TargetT, class Bound1T>
+	class front_binder<TargetT, Bound1T, detail::DefaultVoid>
+	{
+	public:
+		typedef front_binder type;
+
+		front_binder(const TargetT &target, const Bound1T &bound1)
+			: m_target(target),
+			m_bound1(bound1)
+		{ }
+
+		template<class... ArgsT>
+		inline auto operator()(ArgsT&&... args) const
+			-> decltype(std::declval<const TargetT&>()(std::declval<const Bound1T&>(), std::forward<ArgsT>(args)...))
+		{
+			return m_target(m_bound1, std::forward<ArgsT>(args)...);
+		}
+
+	private:
+		TargetT m_target;
+		Bound1T m_bound1;
+	};
+
+	template<class TargetT, class Bound1T>
+	front_binder<typename std::decay<TargetT>::type, typename std::decay<Bound1T>::type>
+		bind_front(TargetT &&target, Bound1T &&bound1)
+	{
+		return front_binder<typename std::decay<TargetT>::type, typename std::decay<Bound1T>::type>(
+			std::forward<TargetT>(target), std::forward<Bound1T>(bound1));
+	}
+
+	template<class TargetT, class Bound1T, class Bound2T>
+	front_binder<typename std::decay<TargetT>::type, typename std::decay<Bound1T>::type, typename std::decay<Bound2T>::type>
+		bind_front(TargetT &&target, Bound1T &&bound1, Bound2T &&bound2)
+	{
+		return front_binder<typename std::decay<TargetT>::type, typename std::decay<Bound1T>::type, typename std::decay<Bound2T>::type>(
+			std::forward<TargetT>(target), std::forward<Bound1T>(bound1), std::forward<Bound2T>(bound2));
+	}
+}
+
+#endif // DELEGATES_CPLUSPLUS < 201103L
+
+#endif // BIND_FRONT_H
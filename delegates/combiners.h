@@ -0,0 +1,143 @@
+#ifndef COMBINERS_H
+#define COMBINERS_H
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+//combiners of the values returned by multicast delegate subscribers, could stop the call early
+
+/******************************************************************************************************************************/
+/* Combiner is given the value returned by each subscriber in turn and returns false to stop the call, so the rest of the     */
+/* subscribers are not called. 'multicast_delegate::invoke(combiner, arguments...)' returns the combiner with its 'result':   */
+/*                                                                                                                            */
+/*   event<bool(const Message&)> on_message;                                                                                  */
+/*                                                                                                                            */
+/*   bool handled = on_message.invoke(combiners::first_true(), message).result; // stops at the first 'true'                  */
+/*                                                                                                                            */
+/*   1) 'first_true' - stops at the first 'true';                                                                             */
+/*   2) 'first_non_null<T>' - stops at the first value that is not null (pointer or anything with 'operator!');               */
+/*   3) 'sum<T>' - sum of all the values, starting with the given one;                                                        */
+/*   4) 'minimum<T>', 'maximum<T>' - the least and the greatest value, 'has_result' is false if nothing was called;           */
+/*   5) 'collect<T>' - values are stored in the given buffer, stops when it is full; 'count' is the number of values stored.  */
+/*                                                                                                                            */
+/* Any other combiner is a functor with 'bool operator()(return_type value)'.                                                 */
+/*                                                                                                                            */
+/******************************************************************************************************************************/
+
+#include <cstddef>
+
+namespace delegates
+{
+	namespace combiners
+	{
+		struct first_true
+		{
+			first_true()
+				: result(false)
+			{ }
+
+			inline bool operator()(bool value)
+			{
+				result = value;
+				return !value;
+			}
+
+			bool result;
+		};
+
+		template<class T>
+		struct first_non_null
+		{
+			first_non_null()
+				: result()
+			{ }
+
+			inline bool operator()(const T &value)
+			{
+				result = value;
+				return !value;
+			}
+
+			T result;
+		};
+
+		template<class T>
+		struct sum
+		{
+			explicit sum(const T &initial = T())
+				: result(initial)
+			{ }
+
+			inline bool operator()(const T &value)
+			{
+				result += value;
+				return true;
+			}
+
+			T result;
+		};
+
+		template<class T>
+		struct minimum
+		{
+			minimum()
+				: result(),
+				has_result(false)
+			{ }
+
+			inline bool operator()(const T &value)
+			{
+				if(!has_result || value < result)
+					result = value;
+				has_result = true;
+				return true;
+			}
+
+			T result;
+			bool has_result;
+		};
+
+		template<class T>
+		struct maximum
+		{
+			maximum()
+				: result(),
+				has_result(false)
+			{ }
+
+			inline bool operator()(const T &value)
+			{
+				if(!has_result || result < value)
+					result = value;
+				has_result = true;
+				return true;
+			}
+
+			T result;
+			bool has_result;
+		};
+
+		template<class T>
+		struct collect
+		{
+			collect(T *buffer, std::size_t capacity)
+				: buffer(buffer),
+				capacity(capacity),
+				count(0)
+			{ }
+
+			inline bool operator()(const T &value)
+			{
+				if(count < capacity)
+					buffer[count++] = value;
+				return count < capacity;
+			}
+
+			T *buffer;
+			std::size_t capacity;
+			std::size_t count;
+		};
+	}
+}
+
+#endif // COMBINERS_H
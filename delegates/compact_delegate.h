@@ -0,0 +1,2632 @@
+#ifndef COMPACT_DELEGATE_H
+#define COMPACT_DELEGATE_H
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+//two pointers sized delegate: object pointer and the code pointer to call with it
+//same bindings as 'delegates::delegate' but the call goes through one plain function pointer
+
+/******************************************************************************************************************************/
+/* 'delegates::compact_delegate<return_type, param_type1, param_type2>' could be bound to:                                    */
+/*                                                                                                                            */
+/*   1) { return_type function(param_type1 param1, param_type2 param2); }                                                     */
+/*   2) { this_type pthis, return_type function(this_type param1, param_type1 param2, param_type2 param3); }                  */
+/*   3) { this_type pthis, return_type this_type::member_function(param_type1 param1, param_type2 param2); }                  */
+/*   4) { this_type pthis, return_type function(const this_type param1, param_type1 param2, param_type2 param3); }            */
+/*   5) { const this_type pthis, return_type this_type::member_function const (param_type1 param1, param_type2 param2); }     */
+/*                                                                                                                            */
+/* 1), 2) and 4) are stored as is: the function itself is the code pointer (for 1) the function is kept in the object         */
+/* pointer, like FASTDELEGATE_USESTATICFUNCTIONHACK does).                                                                    */
+/* 3) and 5) need the compiler specific member function pointer layout to be resolved to the code pointer at bind time, so    */
+/* with run-time member function pointers they are only available with DELEGATES_ITANIUM_MFP (gcc/clang on x86-64/AArch64).   */
+/* Any of 1) - 5) could be bound at compile time on any compiler with 'bind<function>()', 'bind<this_type, &function>(pthis)' */
+/* or 'bind<this_type, &this_type::member_function>(pthis)' - then a thunk calling the function directly is generated.        */
+/*                                                                                                                            */
+/******************************************************************************************************************************/
+
+#include "delegate.h"
+
+namespace delegates
+{
+	template <
+		class ReturnT = detail::DefaultVoid,
+		class Param1T = detail::DefaultVoid,
+		class Param2T = detail::DefaultVoid,
+		class Param3T = detail::DefaultVoid,
+		class Param4T = detail::DefaultVoid,
+		class Param5T = detail::DefaultVoid,
+		class Param6T = detail::DefaultVoid,
+		class Param7T = detail::DefaultVoid,
+		class Param8T = detail::DefaultVoid,
+		class ParamUnusedT = detail::DefaultVoid
+	>
+	class compact_delegate;
+
+	template<class SignatureT>
+	class multicast_delegate;
+
+	template<class SignatureT>
+	class atomic_delegate;
+
+	template<class ReturnT>
+	class compact_delegate<ReturnT, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid>
+	{
+		typedef ReturnT(*free_function_t)();
+		typedef ReturnT(*thunk_type)(void*);
+
+		template<class> friend class multicast_delegate;
+		template<class> friend class atomic_delegate;
+
+	public:
+		typedef compact_delegate type;
+
+		DELEGATES_CONSTEXPR compact_delegate()
+			: m_pthis(NULL),
+			m_thunk(NULL)
+		{ }
+
+		compact_delegate(ReturnT(*function_to_bind)())
+		{
+			bind(function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(*function_to_bind)(Y*))
+			: m_pthis(static_cast<void*>(pthis)),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(*function_to_bind)(const Y*))
+			: m_pthis(static_cast<void*>(pthis)),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(const Y *pthis,
+			ReturnT(*function_to_bind)(const Y*))
+			: m_pthis(const_cast<void*>(static_cast<const void*>(pthis))),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+#ifdef DELEGATES_ITANIUM_MFP
+		template < class X, class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(X::* function_to_bind)())
+		{
+			bind(pthis, function_to_bind);
+		}
+
+		template < class X, class Y >
+		compact_delegate(const Y *pthis,
+			ReturnT(X::* function_to_bind)() const)
+		{
+			bind(pthis, function_to_bind);
+		}
+#endif
+
+		bool operator==(const compact_delegate &other) const
+		{
+			return m_pthis == other.m_pthis && m_thunk == other.m_thunk;
+		}
+
+		bool operator!=(const compact_delegate &other) const
+		{
+			return !(*this == other);
+		}
+
+		bool operator<(const compact_delegate &other) const
+		{
+			return sort_key() < other.sort_key();
+		}
+
+		bool operator>(const compact_delegate &other) const
+		{
+			return other < *this;
+		}
+
+		delegate_sort_key sort_key() const
+		{
+			delegate_sort_key key;
+			key.code = reinterpret_cast<std::size_t>(m_thunk);
+			key.object = reinterpret_cast<std::size_t>(m_pthis);
+			return key;
+		}
+
+		inline void bind(ReturnT(*function_to_bind)()) {
+			if(NULL == function_to_bind)
+			{
+				clear();
+				return;
+			}
+			m_pthis = fastdelegate::detail::horrible_cast<void*>(function_to_bind);
+			m_thunk = &compact_delegate::static_function_thunk;
+		}
+
+		template < class Y >
+		inline void bind(Y *pthis, ReturnT(*function_to_bind)(Y*)) {
+			assert(NULL != function_to_bind);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+		template < class Y >
+		inline void bind(Y *pthis, ReturnT(*function_to_bind)(const Y*)) {
+			assert(NULL != function_to_bind);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+		template < class Y >
+		inline void bind(const Y *pthis, ReturnT(*function_to_bind)(const Y*)) {
+			assert(NULL != function_to_bind);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+#ifdef DELEGATES_ITANIUM_MFP
+		template < class X, class Y >
+		inline void bind(Y *pthis, ReturnT(X::* function_to_bind)()) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = detail::resolve_member_function(fastdelegate::detail::implicit_cast<X*>(pthis), function_to_bind, m_thunk);
+		}
+
+		template < class X, class Y >
+		inline void bind(const Y *pthis, ReturnT(X::* function_to_bind)() const) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = detail::resolve_member_function(const_cast<X*>(fastdelegate::detail::implicit_cast<const X*>(pthis)), function_to_bind, m_thunk);
+		}
+#endif
+
+		template < ReturnT(*function_to_bind)() >
+		inline void bind() {
+			m_pthis = NULL;
+			m_thunk = &compact_delegate::f_thunk_static<function_to_bind>;
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)() >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk_member<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)() const >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = &compact_delegate::f_thunk_const_member<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(Y*) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk_const<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*) >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = &compact_delegate::f_thunk_const<Y, function_to_bind>;
+		}
+
+		template < ReturnT(*function_to_bind)() >
+		static DELEGATES_CONSTEXPR compact_delegate from() {
+			return compact_delegate(&compact_delegate::f_thunk_static<function_to_bind>, NULL);
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)() >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_member<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)() const >
+		static DELEGATES_CONSTEXPR compact_delegate from(const Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const_member<Y, function_to_bind>, const_cast<void*>(static_cast<const void*>(pthis)));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(Y*) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*) >
+		static DELEGATES_CONSTEXPR compact_delegate from(const Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const<Y, function_to_bind>, const_cast<void*>(static_cast<const void*>(pthis)));
+		}
+
+		ReturnT operator()() const
+		{
+			return m_thunk(m_pthis);
+		}
+
+	private:
+		typedef struct SafeBoolStruct {
+			int a_data_pointer_to_this_is_0_on_buggy_compilers;
+			thunk_type m_nonzero;
+		} UselessTypedef;
+		typedef thunk_type SafeBoolStruct::*unspecified_bool_type;
+
+	public:
+		operator unspecified_bool_type() const {
+			return empty() ? 0 : &SafeBoolStruct::m_nonzero;
+		}
+
+		inline bool operator!() const {
+			return empty();
+		}
+
+		inline bool empty() const {
+			return NULL == m_thunk;
+		}
+
+		void clear() {
+			m_pthis = NULL; m_thunk = NULL;
+		}
+
+	private:
+		void *m_pthis;
+		thunk_type m_thunk;
+
+		DELEGATES_CONSTEXPR compact_delegate(thunk_type thunk, void *pthis)
+			: m_pthis(pthis),
+			m_thunk(thunk)
+		{ }
+
+		static ReturnT static_function_thunk(void *pthis)
+		{
+			return fastdelegate::detail::horrible_cast<free_function_t>(pthis)();
+		}
+
+		template< ReturnT(*function_to_bind)() >
+		static ReturnT f_thunk_static(void *)
+		{
+			return function_to_bind();
+		}
+
+		template< class Y, ReturnT(Y::*function_to_bind)() >
+		static ReturnT f_thunk_member(void *pthis)
+		{
+			return (static_cast<Y*>(pthis)->*function_to_bind)();
+		}
+
+		template< class Y, ReturnT(Y::*function_to_bind)() const >
+		static ReturnT f_thunk_const_member(void *pthis)
+		{
+			return (static_cast<const Y*>(pthis)->*function_to_bind)();
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(Y*) >
+		static ReturnT f_thunk(void *pthis)
+		{
+			return function_to_bind(static_cast<Y*>(pthis));
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(const Y*) >
+		static ReturnT f_thunk_const(void *pthis)
+		{
+			return function_to_bind(static_cast<const Y*>(pthis));
+		}
+	};
+
+	template<class ReturnT, class Param1T>
+	class compact_delegate<ReturnT, Param1T, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid>
+	{
+		typedef ReturnT(*free_function_t)(Param1T);
+		typedef ReturnT(*thunk_type)(void*, Param1T);
+
+		template<class> friend class multicast_delegate;
+		template<class> friend class atomic_delegate;
+
+	public:
+		typedef compact_delegate type;
+
+		DELEGATES_CONSTEXPR compact_delegate()
+			: m_pthis(NULL),
+			m_thunk(NULL)
+		{ }
+
+		compact_delegate(ReturnT(*function_to_bind)(Param1T))
+		{
+			bind(function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(*function_to_bind)(Y*, Param1T))
+			: m_pthis(static_cast<void*>(pthis)),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(*function_to_bind)(const Y*, Param1T))
+			: m_pthis(static_cast<void*>(pthis)),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(const Y *pthis,
+			ReturnT(*function_to_bind)(const Y*, Param1T))
+			: m_pthis(const_cast<void*>(static_cast<const void*>(pthis))),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+#ifdef DELEGATES_ITANIUM_MFP
+		template < class X, class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(X::* function_to_bind)(Param1T))
+		{
+			bind(pthis, function_to_bind);
+		}
+
+		template < class X, class Y >
+		compact_delegate(const Y *pthis,
+			ReturnT(X::* function_to_bind)(Param1T) const)
+		{
+			bind(pthis, function_to_bind);
+		}
+#endif
+
+		bool operator==(const compact_delegate &other) const
+		{
+			return m_pthis == other.m_pthis && m_thunk == other.m_thunk;
+		}
+
+		bool operator!=(const compact_delegate &other) const
+		{
+			return !(*this == other);
+		}
+
+		bool operator<(const compact_delegate &other) const
+		{
+			return sort_key() < other.sort_key();
+		}
+
+		bool operator>(const compact_delegate &other) const
+		{
+			return other < *this;
+		}
+
+		delegate_sort_key sort_key() const
+		{
+			delegate_sort_key key;
+			key.code = reinterpret_cast<std::size_t>(m_thunk);
+			key.object = reinterpret_cast<std::size_t>(m_pthis);
+			return key;
+		}
+
+		inline void bind(ReturnT(*function_to_bind)(Param1T)) {
+			if(NULL == function_to_bind)
+			{
+				clear();
+				return;
+			}
+			m_pthis = fastdelegate::detail::horrible_cast<void*>(function_to_bind);
+			m_thunk = &compact_delegate::static_function_thunk;
+		}
+
+		template < class Y >
+		inline void bind(Y *pthis, ReturnT(*function_to_bind)(Y*, Param1T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+		template < class Y >
+		inline void bind(Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+		template < class Y >
+		inline void bind(const Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+#ifdef DELEGATES_ITANIUM_MFP
+		template < class X, class Y >
+		inline void bind(Y *pthis, ReturnT(X::* function_to_bind)(Param1T)) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = detail::resolve_member_function(fastdelegate::detail::implicit_cast<X*>(pthis), function_to_bind, m_thunk);
+		}
+
+		template < class X, class Y >
+		inline void bind(const Y *pthis, ReturnT(X::* function_to_bind)(Param1T) const) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = detail::resolve_member_function(const_cast<X*>(fastdelegate::detail::implicit_cast<const X*>(pthis)), function_to_bind, m_thunk);
+		}
+#endif
+
+		template < ReturnT(*function_to_bind)(Param1T) >
+		inline void bind() {
+			m_pthis = NULL;
+			m_thunk = &compact_delegate::f_thunk_static<function_to_bind>;
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk_member<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T) const >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = &compact_delegate::f_thunk_const_member<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk_const<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T) >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = &compact_delegate::f_thunk_const<Y, function_to_bind>;
+		}
+
+		template < ReturnT(*function_to_bind)(Param1T) >
+		static DELEGATES_CONSTEXPR compact_delegate from() {
+			return compact_delegate(&compact_delegate::f_thunk_static<function_to_bind>, NULL);
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_member<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T) const >
+		static DELEGATES_CONSTEXPR compact_delegate from(const Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const_member<Y, function_to_bind>, const_cast<void*>(static_cast<const void*>(pthis)));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(const Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const<Y, function_to_bind>, const_cast<void*>(static_cast<const void*>(pthis)));
+		}
+
+		ReturnT operator()(Param1T p1) const
+		{
+			return m_thunk(m_pthis, p1);
+		}
+
+	private:
+		typedef struct SafeBoolStruct {
+			int a_data_pointer_to_this_is_0_on_buggy_compilers;
+			thunk_type m_nonzero;
+		} UselessTypedef;
+		typedef thunk_type SafeBoolStruct::*unspecified_bool_type;
+
+	public:
+		operator unspecified_bool_type() const {
+			return empty() ? 0 : &SafeBoolStruct::m_nonzero;
+		}
+
+		inline bool operator!() const {
+			return empty();
+		}
+
+		inline bool empty() const {
+			return NULL == m_thunk;
+		}
+
+		void clear() {
+			m_pthis = NULL; m_thunk = NULL;
+		}
+
+	private:
+		void *m_pthis;
+		thunk_type m_thunk;
+
+		DELEGATES_CONSTEXPR compact_delegate(thunk_type thunk, void *pthis)
+			: m_pthis(pthis),
+			m_thunk(thunk)
+		{ }
+
+		static ReturnT static_function_thunk(void *pthis, Param1T p1)
+		{
+			return fastdelegate::detail::horrible_cast<free_function_t>(pthis)(p1);
+		}
+
+		template< ReturnT(*function_to_bind)(Param1T) >
+		static ReturnT f_thunk_static(void *, Param1T p1)
+		{
+			return function_to_bind(p1);
+		}
+
+		template< class Y, ReturnT(Y::*function_to_bind)(Param1T) >
+		static ReturnT f_thunk_member(void *pthis, Param1T p1)
+		{
+			return (static_cast<Y*>(pthis)->*function_to_bind)(p1);
+		}
+
+		template< class Y, ReturnT(Y::*function_to_bind)(Param1T) const >
+		static ReturnT f_thunk_const_member(void *pthis, Param1T p1)
+		{
+			return (static_cast<const Y*>(pthis)->*function_to_bind)(p1);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(Y*, Param1T) >
+		static ReturnT f_thunk(void *pthis, Param1T p1)
+		{
+			return function_to_bind(static_cast<Y*>(pthis), p1);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(const Y*, Param1T) >
+		static ReturnT f_thunk_const(void *pthis, Param1T p1)
+		{
+			return function_to_bind(static_cast<const Y*>(pthis), p1);
+		}
+	};
+
+	template<class ReturnT, class Param1T, class Param2T>
+	class compact_delegate<ReturnT, Param1T, Param2T, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid>
+	{
+		typedef ReturnT(*free_function_t)(Param1T, Param2T);
+		typedef ReturnT(*thunk_type)(void*, Param1T, Param2T);
+
+		template<class> friend class multicast_delegate;
+		template<class> friend class atomic_delegate;
+
+	public:
+		typedef compact_delegate type;
+
+		DELEGATES_CONSTEXPR compact_delegate()
+			: m_pthis(NULL),
+			m_thunk(NULL)
+		{ }
+
+		compact_delegate(ReturnT(*function_to_bind)(Param1T, Param2T))
+		{
+			bind(function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(*function_to_bind)(Y*, Param1T, Param2T))
+			: m_pthis(static_cast<void*>(pthis)),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T))
+			: m_pthis(static_cast<void*>(pthis)),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(const Y *pthis,
+			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T))
+			: m_pthis(const_cast<void*>(static_cast<const void*>(pthis))),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+#ifdef DELEGATES_ITANIUM_MFP
+		template < class X, class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(X::* function_to_bind)(Param1T, Param2T))
+		{
+			bind(pthis, function_to_bind);
+		}
+
+		template < class X, class Y >
+		compact_delegate(const Y *pthis,
+			ReturnT(X::* function_to_bind)(Param1T, Param2T) const)
+		{
+			bind(pthis, function_to_bind);
+		}
+#endif
+
+		bool operator==(const compact_delegate &other) const
+		{
+			return m_pthis == other.m_pthis && m_thunk == other.m_thunk;
+		}
+
+		bool operator!=(const compact_delegate &other) const
+		{
+			return !(*this == other);
+		}
+
+		bool operator<(const compact_delegate &other) const
+		{
+			return sort_key() < other.sort_key();
+		}
+
+		bool operator>(const compact_delegate &other) const
+		{
+			return other < *this;
+		}
+
+		delegate_sort_key sort_key() const
+		{
+			delegate_sort_key key;
+			key.code = reinterpret_cast<std::size_t>(m_thunk);
+			key.object = reinterpret_cast<std::size_t>(m_pthis);
+			return key;
+		}
+
+		inline void bind(ReturnT(*function_to_bind)(Param1T, Param2T)) {
+			if(NULL == function_to_bind)
+			{
+				clear();
+				return;
+			}
+			m_pthis = fastdelegate::detail::horrible_cast<void*>(function_to_bind);
+			m_thunk = &compact_delegate::static_function_thunk;
+		}
+
+		template < class Y >
+		inline void bind(Y *pthis, ReturnT(*function_to_bind)(Y*, Param1T, Param2T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+		template < class Y >
+		inline void bind(Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+		template < class Y >
+		inline void bind(const Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+#ifdef DELEGATES_ITANIUM_MFP
+		template < class X, class Y >
+		inline void bind(Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T)) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = detail::resolve_member_function(fastdelegate::detail::implicit_cast<X*>(pthis), function_to_bind, m_thunk);
+		}
+
+		template < class X, class Y >
+		inline void bind(const Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T) const) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = detail::resolve_member_function(const_cast<X*>(fastdelegate::detail::implicit_cast<const X*>(pthis)), function_to_bind, m_thunk);
+		}
+#endif
+
+		template < ReturnT(*function_to_bind)(Param1T, Param2T) >
+		inline void bind() {
+			m_pthis = NULL;
+			m_thunk = &compact_delegate::f_thunk_static<function_to_bind>;
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk_member<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T) const >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = &compact_delegate::f_thunk_const_member<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk_const<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T) >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = &compact_delegate::f_thunk_const<Y, function_to_bind>;
+		}
+
+		template < ReturnT(*function_to_bind)(Param1T, Param2T) >
+		static DELEGATES_CONSTEXPR compact_delegate from() {
+			return compact_delegate(&compact_delegate::f_thunk_static<function_to_bind>, NULL);
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_member<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T) const >
+		static DELEGATES_CONSTEXPR compact_delegate from(const Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const_member<Y, function_to_bind>, const_cast<void*>(static_cast<const void*>(pthis)));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(const Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const<Y, function_to_bind>, const_cast<void*>(static_cast<const void*>(pthis)));
+		}
+
+		ReturnT operator()(Param1T p1, Param2T p2) const
+		{
+			return m_thunk(m_pthis, p1, p2);
+		}
+
+	private:
+		typedef struct SafeBoolStruct {
+			int a_data_pointer_to_this_is_0_on_buggy_compilers;
+			thunk_type m_nonzero;
+		} UselessTypedef;
+		typedef thunk_type SafeBoolStruct::*unspecified_bool_type;
+
+	public:
+		operator unspecified_bool_type() const {
+			return empty() ? 0 : &SafeBoolStruct::m_nonzero;
+		}
+
+		inline bool operator!() const {
+			return empty();
+		}
+
+		inline bool empty() const {
+			return NULL == m_thunk;
+		}
+
+		void clear() {
+			m_pthis = NULL; m_thunk = NULL;
+		}
+
+	private:
+		void *m_pthis;
+		thunk_type m_thunk;
+
+		DELEGATES_CONSTEXPR compact_delegate(thunk_type thunk, void *pthis)
+			: m_pthis(pthis),
+			m_thunk(thunk)
+		{ }
+
+		static ReturnT static_function_thunk(void *pthis, Param1T p1, Param2T p2)
+		{
+			return fastdelegate::detail::horrible_cast<free_function_t>(pthis)(p1, p2);
+		}
+
+		template< ReturnT(*function_to_bind)(Param1T, Param2T) >
+		static ReturnT f_thunk_static(void *, Param1T p1, Param2T p2)
+		{
+			return function_to_bind(p1, p2);
+		}
+
+		template< class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T) >
+		static ReturnT f_thunk_member(void *pthis, Param1T p1, Param2T p2)
+		{
+			return (static_cast<Y*>(pthis)->*function_to_bind)(p1, p2);
+		}
+
+		template< class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T) const >
+		static ReturnT f_thunk_const_member(void *pthis, Param1T p1, Param2T p2)
+		{
+			return (static_cast<const Y*>(pthis)->*function_to_bind)(p1, p2);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T) >
+		static ReturnT f_thunk(void *pthis, Param1T p1, Param2T p2)
+		{
+			return function_to_bind(static_cast<Y*>(pthis), p1, p2);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T) >
+		static ReturnT f_thunk_const(void *pthis, Param1T p1, Param2T p2)
+		{
+			return function_to_bind(static_cast<const Y*>(pthis), p1, p2);
+		}
+	};
+
+	template<class ReturnT, class Param1T, class Param2T, class Param3T>
+	class compact_delegate<ReturnT, Param1T, Param2T, Param3T, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid>
+	{
+		typedef ReturnT(*free_function_t)(Param1T, Param2T, Param3T);
+		typedef ReturnT(*thunk_type)(void*, Param1T, Param2T, Param3T);
+
+		template<class> friend class multicast_delegate;
+		template<class> friend class atomic_delegate;
+
+	public:
+		typedef compact_delegate type;
+
+		DELEGATES_CONSTEXPR compact_delegate()
+			: m_pthis(NULL),
+			m_thunk(NULL)
+		{ }
+
+		compact_delegate(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T))
+		{
+			bind(function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T))
+			: m_pthis(static_cast<void*>(pthis)),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T))
+			: m_pthis(static_cast<void*>(pthis)),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(const Y *pthis,
+			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T))
+			: m_pthis(const_cast<void*>(static_cast<const void*>(pthis))),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+#ifdef DELEGATES_ITANIUM_MFP
+		template < class X, class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T))
+		{
+			bind(pthis, function_to_bind);
+		}
+
+		template < class X, class Y >
+		compact_delegate(const Y *pthis,
+			ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T) const)
+		{
+			bind(pthis, function_to_bind);
+		}
+#endif
+
+		bool operator==(const compact_delegate &other) const
+		{
+			return m_pthis == other.m_pthis && m_thunk == other.m_thunk;
+		}
+
+		bool operator!=(const compact_delegate &other) const
+		{
+			return !(*this == other);
+		}
+
+		bool operator<(const compact_delegate &other) const
+		{
+			return sort_key() < other.sort_key();
+		}
+
+		bool operator>(const compact_delegate &other) const
+		{
+			return other < *this;
+		}
+
+		delegate_sort_key sort_key() const
+		{
+			delegate_sort_key key;
+			key.code = reinterpret_cast<std::size_t>(m_thunk);
+			key.object = reinterpret_cast<std::size_t>(m_pthis);
+			return key;
+		}
+
+		inline void bind(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T)) {
+			if(NULL == function_to_bind)
+			{
+				clear();
+				return;
+			}
+			m_pthis = fastdelegate::detail::horrible_cast<void*>(function_to_bind);
+			m_thunk = &compact_delegate::static_function_thunk;
+		}
+
+		template < class Y >
+		inline void bind(Y *pthis, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+		template < class Y >
+		inline void bind(Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+		template < class Y >
+		inline void bind(const Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+#ifdef DELEGATES_ITANIUM_MFP
+		template < class X, class Y >
+		inline void bind(Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T)) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = detail::resolve_member_function(fastdelegate::detail::implicit_cast<X*>(pthis), function_to_bind, m_thunk);
+		}
+
+		template < class X, class Y >
+		inline void bind(const Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T) const) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = detail::resolve_member_function(const_cast<X*>(fastdelegate::detail::implicit_cast<const X*>(pthis)), function_to_bind, m_thunk);
+		}
+#endif
+
+		template < ReturnT(*function_to_bind)(Param1T, Param2T, Param3T) >
+		inline void bind() {
+			m_pthis = NULL;
+			m_thunk = &compact_delegate::f_thunk_static<function_to_bind>;
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk_member<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T) const >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = &compact_delegate::f_thunk_const_member<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk_const<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T) >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = &compact_delegate::f_thunk_const<Y, function_to_bind>;
+		}
+
+		template < ReturnT(*function_to_bind)(Param1T, Param2T, Param3T) >
+		static DELEGATES_CONSTEXPR compact_delegate from() {
+			return compact_delegate(&compact_delegate::f_thunk_static<function_to_bind>, NULL);
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_member<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T) const >
+		static DELEGATES_CONSTEXPR compact_delegate from(const Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const_member<Y, function_to_bind>, const_cast<void*>(static_cast<const void*>(pthis)));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(const Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const<Y, function_to_bind>, const_cast<void*>(static_cast<const void*>(pthis)));
+		}
+
+		ReturnT operator()(Param1T p1, Param2T p2, Param3T p3) const
+		{
+			return m_thunk(m_pthis, p1, p2, p3);
+		}
+
+	private:
+		typedef struct SafeBoolStruct {
+			int a_data_pointer_to_this_is_0_on_buggy_compilers;
+			thunk_type m_nonzero;
+		} UselessTypedef;
+		typedef thunk_type SafeBoolStruct::*unspecified_bool_type;
+
+	public:
+		operator unspecified_bool_type() const {
+			return empty() ? 0 : &SafeBoolStruct::m_nonzero;
+		}
+
+		inline bool operator!() const {
+			return empty();
+		}
+
+		inline bool empty() const {
+			return NULL == m_thunk;
+		}
+
+		void clear() {
+			m_pthis = NULL; m_thunk = NULL;
+		}
+
+	private:
+		void *m_pthis;
+		thunk_type m_thunk;
+
+		DELEGATES_CONSTEXPR compact_delegate(thunk_type thunk, void *pthis)
+			: m_pthis(pthis),
+			m_thunk(thunk)
+		{ }
+
+		static ReturnT static_function_thunk(void *pthis, Param1T p1, Param2T p2, Param3T p3)
+		{
+			return fastdelegate::detail::horrible_cast<free_function_t>(pthis)(p1, p2, p3);
+		}
+
+		template< ReturnT(*function_to_bind)(Param1T, Param2T, Param3T) >
+		static ReturnT f_thunk_static(void *, Param1T p1, Param2T p2, Param3T p3)
+		{
+			return function_to_bind(p1, p2, p3);
+		}
+
+		template< class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T) >
+		static ReturnT f_thunk_member(void *pthis, Param1T p1, Param2T p2, Param3T p3)
+		{
+			return (static_cast<Y*>(pthis)->*function_to_bind)(p1, p2, p3);
+		}
+
+		template< class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T) const >
+		static ReturnT f_thunk_const_member(void *pthis, Param1T p1, Param2T p2, Param3T p3)
+		{
+			return (static_cast<const Y*>(pthis)->*function_to_bind)(p1, p2, p3);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T) >
+		static ReturnT f_thunk(void *pthis, Param1T p1, Param2T p2, Param3T p3)
+		{
+			return function_to_bind(static_cast<Y*>(pthis), p1, p2, p3);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T) >
+		static ReturnT f_thunk_const(void *pthis, Param1T p1, Param2T p2, Param3T p3)
+		{
+			return function_to_bind(static_cast<const Y*>(pthis), p1, p2, p3);
+		}
+	};
+
+	template<class ReturnT, class Param1T, class Param2T, class Param3T, class Param4T>
+	class compact_delegate<ReturnT, Param1T, Param2T, Param3T, Param4T, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid>
+	{
+		typedef ReturnT(*free_function_t)(Param1T, Param2T, Param3T, Param4T);
+		typedef ReturnT(*thunk_type)(void*, Param1T, Param2T, Param3T, Param4T);
+
+		template<class> friend class multicast_delegate;
+		template<class> friend class atomic_delegate;
+
+	public:
+		typedef compact_delegate type;
+
+		DELEGATES_CONSTEXPR compact_delegate()
+			: m_pthis(NULL),
+			m_thunk(NULL)
+		{ }
+
+		compact_delegate(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T))
+		{
+			bind(function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T))
+			: m_pthis(static_cast<void*>(pthis)),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T))
+			: m_pthis(static_cast<void*>(pthis)),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(const Y *pthis,
+			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T))
+			: m_pthis(const_cast<void*>(static_cast<const void*>(pthis))),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+#ifdef DELEGATES_ITANIUM_MFP
+		template < class X, class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T))
+		{
+			bind(pthis, function_to_bind);
+		}
+
+		template < class X, class Y >
+		compact_delegate(const Y *pthis,
+			ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T) const)
+		{
+			bind(pthis, function_to_bind);
+		}
+#endif
+
+		bool operator==(const compact_delegate &other) const
+		{
+			return m_pthis == other.m_pthis && m_thunk == other.m_thunk;
+		}
+
+		bool operator!=(const compact_delegate &other) const
+		{
+			return !(*this == other);
+		}
+
+		bool operator<(const compact_delegate &other) const
+		{
+			return sort_key() < other.sort_key();
+		}
+
+		bool operator>(const compact_delegate &other) const
+		{
+			return other < *this;
+		}
+
+		delegate_sort_key sort_key() const
+		{
+			delegate_sort_key key;
+			key.code = reinterpret_cast<std::size_t>(m_thunk);
+			key.object = reinterpret_cast<std::size_t>(m_pthis);
+			return key;
+		}
+
+		inline void bind(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T)) {
+			if(NULL == function_to_bind)
+			{
+				clear();
+				return;
+			}
+			m_pthis = fastdelegate::detail::horrible_cast<void*>(function_to_bind);
+			m_thunk = &compact_delegate::static_function_thunk;
+		}
+
+		template < class Y >
+		inline void bind(Y *pthis, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+		template < class Y >
+		inline void bind(Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+		template < class Y >
+		inline void bind(const Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+#ifdef DELEGATES_ITANIUM_MFP
+		template < class X, class Y >
+		inline void bind(Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T)) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = detail::resolve_member_function(fastdelegate::detail::implicit_cast<X*>(pthis), function_to_bind, m_thunk);
+		}
+
+		template < class X, class Y >
+		inline void bind(const Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T) const) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = detail::resolve_member_function(const_cast<X*>(fastdelegate::detail::implicit_cast<const X*>(pthis)), function_to_bind, m_thunk);
+		}
+#endif
+
+		template < ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T) >
+		inline void bind() {
+			m_pthis = NULL;
+			m_thunk = &compact_delegate::f_thunk_static<function_to_bind>;
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk_member<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T) const >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = &compact_delegate::f_thunk_const_member<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk_const<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T) >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = &compact_delegate::f_thunk_const<Y, function_to_bind>;
+		}
+
+		template < ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T) >
+		static DELEGATES_CONSTEXPR compact_delegate from() {
+			return compact_delegate(&compact_delegate::f_thunk_static<function_to_bind>, NULL);
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_member<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T) const >
+		static DELEGATES_CONSTEXPR compact_delegate from(const Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const_member<Y, function_to_bind>, const_cast<void*>(static_cast<const void*>(pthis)));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(const Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const<Y, function_to_bind>, const_cast<void*>(static_cast<const void*>(pthis)));
+		}
+
+		ReturnT operator()(Param1T p1, Param2T p2, Param3T p3, Param4T p4) const
+		{
+			return m_thunk(m_pthis, p1, p2, p3, p4);
+		}
+
+	private:
+		typedef struct SafeBoolStruct {
+			int a_data_pointer_to_this_is_0_on_buggy_compilers;
+			thunk_type m_nonzero;
+		} UselessTypedef;
+		typedef thunk_type SafeBoolStruct::*unspecified_bool_type;
+
+	public:
+		operator unspecified_bool_type() const {
+			return empty() ? 0 : &SafeBoolStruct::m_nonzero;
+		}
+
+		inline bool operator!() const {
+			return empty();
+		}
+
+		inline bool empty() const {
+			return NULL == m_thunk;
+		}
+
+		void clear() {
+			m_pthis = NULL; m_thunk = NULL;
+		}
+
+	private:
+		void *m_pthis;
+		thunk_type m_thunk;
+
+		DELEGATES_CONSTEXPR compact_delegate(thunk_type thunk, void *pthis)
+			: m_pthis(pthis),
+			m_thunk(thunk)
+		{ }
+
+		static ReturnT static_function_thunk(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4)
+		{
+			return fastdelegate::detail::horrible_cast<free_function_t>(pthis)(p1, p2, p3, p4);
+		}
+
+		template< ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T) >
+		static ReturnT f_thunk_static(void *, Param1T p1, Param2T p2, Param3T p3, Param4T p4)
+		{
+			return function_to_bind(p1, p2, p3, p4);
+		}
+
+		template< class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T) >
+		static ReturnT f_thunk_member(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4)
+		{
+			return (static_cast<Y*>(pthis)->*function_to_bind)(p1, p2, p3, p4);
+		}
+
+		template< class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T) const >
+		static ReturnT f_thunk_const_member(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4)
+		{
+			return (static_cast<const Y*>(pthis)->*function_to_bind)(p1, p2, p3, p4);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T) >
+		static ReturnT f_thunk(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4)
+		{
+			return function_to_bind(static_cast<Y*>(pthis), p1, p2, p3, p4);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T) >
+		static ReturnT f_thunk_const(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4)
+		{
+			return function_to_bind(static_cast<const Y*>(pthis), p1, p2, p3, p4);
+		}
+	};
+
+	template<class ReturnT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T>
+	class compact_delegate<ReturnT, Param1T, Param2T, Param3T, Param4T, Param5T, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid>
+	{
+		typedef ReturnT(*free_function_t)(Param1T, Param2T, Param3T, Param4T, Param5T);
+		typedef ReturnT(*thunk_type)(void*, Param1T, Param2T, Param3T, Param4T, Param5T);
+
+		template<class> friend class multicast_delegate;
+		template<class> friend class atomic_delegate;
+
+	public:
+		typedef compact_delegate type;
+
+		DELEGATES_CONSTEXPR compact_delegate()
+			: m_pthis(NULL),
+			m_thunk(NULL)
+		{ }
+
+		compact_delegate(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T))
+		{
+			bind(function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T))
+			: m_pthis(static_cast<void*>(pthis)),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T))
+			: m_pthis(static_cast<void*>(pthis)),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(const Y *pthis,
+			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T))
+			: m_pthis(const_cast<void*>(static_cast<const void*>(pthis))),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+#ifdef DELEGATES_ITANIUM_MFP
+		template < class X, class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T))
+		{
+			bind(pthis, function_to_bind);
+		}
+
+		template < class X, class Y >
+		compact_delegate(const Y *pthis,
+			ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T) const)
+		{
+			bind(pthis, function_to_bind);
+		}
+#endif
+
+		bool operator==(const compact_delegate &other) const
+		{
+			return m_pthis == other.m_pthis && m_thunk == other.m_thunk;
+		}
+
+		bool operator!=(const compact_delegate &other) const
+		{
+			return !(*this == other);
+		}
+
+		bool operator<(const compact_delegate &other) const
+		{
+			return sort_key() < other.sort_key();
+		}
+
+		bool operator>(const compact_delegate &other) const
+		{
+			return other < *this;
+		}
+
+		delegate_sort_key sort_key() const
+		{
+			delegate_sort_key key;
+			key.code = reinterpret_cast<std::size_t>(m_thunk);
+			key.object = reinterpret_cast<std::size_t>(m_pthis);
+			return key;
+		}
+
+		inline void bind(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T)) {
+			if(NULL == function_to_bind)
+			{
+				clear();
+				return;
+			}
+			m_pthis = fastdelegate::detail::horrible_cast<void*>(function_to_bind);
+			m_thunk = &compact_delegate::static_function_thunk;
+		}
+
+		template < class Y >
+		inline void bind(Y *pthis, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+		template < class Y >
+		inline void bind(Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+		template < class Y >
+		inline void bind(const Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+#ifdef DELEGATES_ITANIUM_MFP
+		template < class X, class Y >
+		inline void bind(Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T)) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = detail::resolve_member_function(fastdelegate::detail::implicit_cast<X*>(pthis), function_to_bind, m_thunk);
+		}
+
+		template < class X, class Y >
+		inline void bind(const Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T) const) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = detail::resolve_member_function(const_cast<X*>(fastdelegate::detail::implicit_cast<const X*>(pthis)), function_to_bind, m_thunk);
+		}
+#endif
+
+		template < ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T) >
+		inline void bind() {
+			m_pthis = NULL;
+			m_thunk = &compact_delegate::f_thunk_static<function_to_bind>;
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk_member<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T) const >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = &compact_delegate::f_thunk_const_member<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk_const<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T) >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = &compact_delegate::f_thunk_const<Y, function_to_bind>;
+		}
+
+		template < ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T) >
+		static DELEGATES_CONSTEXPR compact_delegate from() {
+			return compact_delegate(&compact_delegate::f_thunk_static<function_to_bind>, NULL);
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_member<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T) const >
+		static DELEGATES_CONSTEXPR compact_delegate from(const Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const_member<Y, function_to_bind>, const_cast<void*>(static_cast<const void*>(pthis)));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(const Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const<Y, function_to_bind>, const_cast<void*>(static_cast<const void*>(pthis)));
+		}
+
+		ReturnT operator()(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5) const
+		{
+			return m_thunk(m_pthis, p1, p2, p3, p4, p5);
+		}
+
+	private:
+		typedef struct SafeBoolStruct {
+			int a_data_pointer_to_this_is_0_on_buggy_compilers;
+			thunk_type m_nonzero;
+		} UselessTypedef;
+		typedef thunk_type SafeBoolStruct::*unspecified_bool_type;
+
+	public:
+		operator unspecified_bool_type() const {
+			return empty() ? 0 : &SafeBoolStruct::m_nonzero;
+		}
+
+		inline bool operator!() const {
+			return empty();
+		}
+
+		inline bool empty() const {
+			return NULL == m_thunk;
+		}
+
+		void clear() {
+			m_pthis = NULL; m_thunk = NULL;
+		}
+
+	private:
+		void *m_pthis;
+		thunk_type m_thunk;
+
+		DELEGATES_CONSTEXPR compact_delegate(thunk_type thunk, void *pthis)
+			: m_pthis(pthis),
+			m_thunk(thunk)
+		{ }
+
+		static ReturnT static_function_thunk(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5)
+		{
+			return fastdelegate::detail::horrible_cast<free_function_t>(pthis)(p1, p2, p3, p4, p5);
+		}
+
+		template< ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T) >
+		static ReturnT f_thunk_static(void *, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5)
+		{
+			return function_to_bind(p1, p2, p3, p4, p5);
+		}
+
+		template< class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T) >
+		static ReturnT f_thunk_member(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5)
+		{
+			return (static_cast<Y*>(pthis)->*function_to_bind)(p1, p2, p3, p4, p5);
+		}
+
+		template< class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T) const >
+		static ReturnT f_thunk_const_member(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5)
+		{
+			return (static_cast<const Y*>(pthis)->*function_to_bind)(p1, p2, p3, p4, p5);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T) >
+		static ReturnT f_thunk(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5)
+		{
+			return function_to_bind(static_cast<Y*>(pthis), p1, p2, p3, p4, p5);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T) >
+		static ReturnT f_thunk_const(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5)
+		{
+			return function_to_bind(static_cast<const Y*>(pthis), p1, p2, p3, p4, p5);
+		}
+	};
+
+	template<class ReturnT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T, class Param6T>
+	class compact_delegate<ReturnT, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid>
+	{
+		typedef ReturnT(*free_function_t)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T);
+		typedef ReturnT(*thunk_type)(void*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T);
+
+		template<class> friend class multicast_delegate;
+		template<class> friend class atomic_delegate;
+
+	public:
+		typedef compact_delegate type;
+
+		DELEGATES_CONSTEXPR compact_delegate()
+			: m_pthis(NULL),
+			m_thunk(NULL)
+		{ }
+
+		compact_delegate(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T))
+		{
+			bind(function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T))
+			: m_pthis(static_cast<void*>(pthis)),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T))
+			: m_pthis(static_cast<void*>(pthis)),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(const Y *pthis,
+			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T))
+			: m_pthis(const_cast<void*>(static_cast<const void*>(pthis))),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+#ifdef DELEGATES_ITANIUM_MFP
+		template < class X, class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T))
+		{
+			bind(pthis, function_to_bind);
+		}
+
+		template < class X, class Y >
+		compact_delegate(const Y *pthis,
+			ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) const)
+		{
+			bind(pthis, function_to_bind);
+		}
+#endif
+
+		bool operator==(const compact_delegate &other) const
+		{
+			return m_pthis == other.m_pthis && m_thunk == other.m_thunk;
+		}
+
+		bool operator!=(const compact_delegate &other) const
+		{
+			return !(*this == other);
+		}
+
+		bool operator<(const compact_delegate &other) const
+		{
+			return sort_key() < other.sort_key();
+		}
+
+		bool operator>(const compact_delegate &other) const
+		{
+			return other < *this;
+		}
+
+		delegate_sort_key sort_key() const
+		{
+			delegate_sort_key key;
+			key.code = reinterpret_cast<std::size_t>(m_thunk);
+			key.object = reinterpret_cast<std::size_t>(m_pthis);
+			return key;
+		}
+
+		inline void bind(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T)) {
+			if(NULL == function_to_bind)
+			{
+				clear();
+				return;
+			}
+			m_pthis = fastdelegate::detail::horrible_cast<void*>(function_to_bind);
+			m_thunk = &compact_delegate::static_function_thunk;
+		}
+
+		template < class Y >
+		inline void bind(Y *pthis, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+		template < class Y >
+		inline void bind(Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+		template < class Y >
+		inline void bind(const Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+#ifdef DELEGATES_ITANIUM_MFP
+		template < class X, class Y >
+		inline void bind(Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T)) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = detail::resolve_member_function(fastdelegate::detail::implicit_cast<X*>(pthis), function_to_bind, m_thunk);
+		}
+
+		template < class X, class Y >
+		inline void bind(const Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) const) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = detail::resolve_member_function(const_cast<X*>(fastdelegate::detail::implicit_cast<const X*>(pthis)), function_to_bind, m_thunk);
+		}
+#endif
+
+		template < ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+		inline void bind() {
+			m_pthis = NULL;
+			m_thunk = &compact_delegate::f_thunk_static<function_to_bind>;
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk_member<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) const >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = &compact_delegate::f_thunk_const_member<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk_const<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = &compact_delegate::f_thunk_const<Y, function_to_bind>;
+		}
+
+		template < ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+		static DELEGATES_CONSTEXPR compact_delegate from() {
+			return compact_delegate(&compact_delegate::f_thunk_static<function_to_bind>, NULL);
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_member<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) const >
+		static DELEGATES_CONSTEXPR compact_delegate from(const Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const_member<Y, function_to_bind>, const_cast<void*>(static_cast<const void*>(pthis)));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(const Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const<Y, function_to_bind>, const_cast<void*>(static_cast<const void*>(pthis)));
+		}
+
+		ReturnT operator()(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6) const
+		{
+			return m_thunk(m_pthis, p1, p2, p3, p4, p5, p6);
+		}
+
+	private:
+		typedef struct SafeBoolStruct {
+			int a_data_pointer_to_this_is_0_on_buggy_compilers;
+			thunk_type m_nonzero;
+		} UselessTypedef;
+		typedef thunk_type SafeBoolStruct::*unspecified_bool_type;
+
+	public:
+		operator unspecified_bool_type() const {
+			return empty() ? 0 : &SafeBoolStruct::m_nonzero;
+		}
+
+		inline bool operator!() const {
+			return empty();
+		}
+
+		inline bool empty() const {
+			return NULL == m_thunk;
+		}
+
+		void clear() {
+			m_pthis = NULL; m_thunk = NULL;
+		}
+
+	private:
+		void *m_pthis;
+		thunk_type m_thunk;
+
+		DELEGATES_CONSTEXPR compact_delegate(thunk_type thunk, void *pthis)
+			: m_pthis(pthis),
+			m_thunk(thunk)
+		{ }
+
+		static ReturnT static_function_thunk(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6)
+		{
+			return fastdelegate::detail::horrible_cast<free_function_t>(pthis)(p1, p2, p3, p4, p5, p6);
+		}
+
+		template< ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+		static ReturnT f_thunk_static(void *, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6)
+		{
+			return function_to_bind(p1, p2, p3, p4, p5, p6);
+		}
+
+		template< class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+		static ReturnT f_thunk_member(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6)
+		{
+			return (static_cast<Y*>(pthis)->*function_to_bind)(p1, p2, p3, p4, p5, p6);
+		}
+
+		template< class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) const >
+		static ReturnT f_thunk_const_member(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6)
+		{
+			return (static_cast<const Y*>(pthis)->*function_to_bind)(p1, p2, p3, p4, p5, p6);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+		static ReturnT f_thunk(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6)
+		{
+			return function_to_bind(static_cast<Y*>(pthis), p1, p2, p3, p4, p5, p6);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+		static ReturnT f_thunk_const(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6)
+		{
+			return function_to_bind(static_cast<const Y*>(pthis), p1, p2, p3, p4, p5, p6);
+		}
+	};
+
+	template<class ReturnT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T, class Param6T, class Param7T>
+	class compact_delegate<ReturnT, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, detail::DefaultVoid, detail::DefaultVoid>
+	{
+		typedef ReturnT(*free_function_t)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T);
+		typedef ReturnT(*thunk_type)(void*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T);
+
+		template<class> friend class multicast_delegate;
+		template<class> friend class atomic_delegate;
+
+	public:
+		typedef compact_delegate type;
+
+		DELEGATES_CONSTEXPR compact_delegate()
+			: m_pthis(NULL),
+			m_thunk(NULL)
+		{ }
+
+		compact_delegate(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T))
+		{
+			bind(function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T))
+			: m_pthis(static_cast<void*>(pthis)),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T))
+			: m_pthis(static_cast<void*>(pthis)),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(const Y *pthis,
+			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T))
+			: m_pthis(const_cast<void*>(static_cast<const void*>(pthis))),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+#ifdef DELEGATES_ITANIUM_MFP
+		template < class X, class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T))
+		{
+			bind(pthis, function_to_bind);
+		}
+
+		template < class X, class Y >
+		compact_delegate(const Y *pthis,
+			ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) const)
+		{
+			bind(pthis, function_to_bind);
+		}
+#endif
+
+		bool operator==(const compact_delegate &other) const
+		{
+			return m_pthis == other.m_pthis && m_thunk == other.m_thunk;
+		}
+
+		bool operator!=(const compact_delegate &other) const
+		{
+			return !(*this == other);
+		}
+
+		bool operator<(const compact_delegate &other) const
+		{
+			return sort_key() < other.sort_key();
+		}
+
+		bool operator>(const compact_delegate &other) const
+		{
+			return other < *this;
+		}
+
+		delegate_sort_key sort_key() const
+		{
+			delegate_sort_key key;
+			key.code = reinterpret_cast<std::size_t>(m_thunk);
+			key.object = reinterpret_cast<std::size_t>(m_pthis);
+			return key;
+		}
+
+		inline void bind(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)) {
+			if(NULL == function_to_bind)
+			{
+				clear();
+				return;
+			}
+			m_pthis = fastdelegate::detail::horrible_cast<void*>(function_to_bind);
+			m_thunk = &compact_delegate::static_function_thunk;
+		}
+
+		template < class Y >
+		inline void bind(Y *pthis, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+		template < class Y >
+		inline void bind(Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+		template < class Y >
+		inline void bind(const Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+#ifdef DELEGATES_ITANIUM_MFP
+		template < class X, class Y >
+		inline void bind(Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = detail::resolve_member_function(fastdelegate::detail::implicit_cast<X*>(pthis), function_to_bind, m_thunk);
+		}
+
+		template < class X, class Y >
+		inline void bind(const Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) const) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = detail::resolve_member_function(const_cast<X*>(fastdelegate::detail::implicit_cast<const X*>(pthis)), function_to_bind, m_thunk);
+		}
+#endif
+
+		template < ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+		inline void bind() {
+			m_pthis = NULL;
+			m_thunk = &compact_delegate::f_thunk_static<function_to_bind>;
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk_member<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) const >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = &compact_delegate::f_thunk_const_member<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk_const<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = &compact_delegate::f_thunk_const<Y, function_to_bind>;
+		}
+
+		template < ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+		static DELEGATES_CONSTEXPR compact_delegate from() {
+			return compact_delegate(&compact_delegate::f_thunk_static<function_to_bind>, NULL);
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_member<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) const >
+		static DELEGATES_CONSTEXPR compact_delegate from(const Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const_member<Y, function_to_bind>, const_cast<void*>(static_cast<const void*>(pthis)));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(const Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const<Y, function_to_bind>, const_cast<void*>(static_cast<const void*>(pthis)));
+		}
+
+		ReturnT operator()(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7) const
+		{
+			return m_thunk(m_pthis, p1, p2, p3, p4, p5, p6, p7);
+		}
+
+	private:
+		typedef struct SafeBoolStruct {
+			int a_data_pointer_to_this_is_0_on_buggy_compilers;
+			thunk_type m_nonzero;
+		} UselessTypedef;
+		typedef thunk_type SafeBoolStruct::*unspecified_bool_type;
+
+	public:
+		operator unspecified_bool_type() const {
+			return empty() ? 0 : &SafeBoolStruct::m_nonzero;
+		}
+
+		inline bool operator!() const {
+			return empty();
+		}
+
+		inline bool empty() const {
+			return NULL == m_thunk;
+		}
+
+		void clear() {
+			m_pthis = NULL; m_thunk = NULL;
+		}
+
+	private:
+		void *m_pthis;
+		thunk_type m_thunk;
+
+		DELEGATES_CONSTEXPR compact_delegate(thunk_type thunk, void *pthis)
+			: m_pthis(pthis),
+			m_thunk(thunk)
+		{ }
+
+		static ReturnT static_function_thunk(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7)
+		{
+			return fastdelegate::detail::horrible_cast<free_function_t>(pthis)(p1, p2, p3, p4, p5, p6, p7);
+		}
+
+		template< ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+		static ReturnT f_thunk_static(void *, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7)
+		{
+			return function_to_bind(p1, p2, p3, p4, p5, p6, p7);
+		}
+
+		template< class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+		static ReturnT f_thunk_member(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7)
+		{
+			return (static_cast<Y*>(pthis)->*function_to_bind)(p1, p2, p3, p4, p5, p6, p7);
+		}
+
+		template< class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) const >
+		static ReturnT f_thunk_const_member(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7)
+		{
+			return (static_cast<const Y*>(pthis)->*function_to_bind)(p1, p2, p3, p4, p5, p6, p7);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+		static ReturnT f_thunk(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7)
+		{
+			return function_to_bind(static_cast<Y*>(pthis), p1, p2, p3, p4, p5, p6, p7);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+		static ReturnT f_thunk_const(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7)
+		{
+			return function_to_bind(static_cast<const Y*>(pthis), p1, p2, p3, p4, p5, p6, p7);
+		}
+	};
+
+	template<class ReturnT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T, class Param6T, class Param7T, class Param8T>
+	class compact_delegate<ReturnT, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T, detail::DefaultVoid>
+	{
+		typedef ReturnT(*free_function_t)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T);
+		typedef ReturnT(*thunk_type)(void*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T);
+
+		template<class> friend class multicast_delegate;
+		template<class> friend class atomic_delegate;
+
+	public:
+		typedef compact_delegate type;
+
+		DELEGATES_CONSTEXPR compact_delegate()
+			: m_pthis(NULL),
+			m_thunk(NULL)
+		{ }
+
+		compact_delegate(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T))
+		{
+			bind(function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T))
+			: m_pthis(static_cast<void*>(pthis)),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T))
+			: m_pthis(static_cast<void*>(pthis)),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+		template < class Y >
+		compact_delegate(const Y *pthis,
+			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T))
+			: m_pthis(const_cast<void*>(static_cast<const void*>(pthis))),
+			m_thunk(reinterpret_cast<thunk_type>(function_to_bind))
+		{
+			assert(NULL != function_to_bind);
+		}
+
+#ifdef DELEGATES_ITANIUM_MFP
+		template < class X, class Y >
+		compact_delegate(Y *pthis,
+			ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T))
+		{
+			bind(pthis, function_to_bind);
+		}
+
+		template < class X, class Y >
+		compact_delegate(const Y *pthis,
+			ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) const)
+		{
+			bind(pthis, function_to_bind);
+		}
+#endif
+
+		bool operator==(const compact_delegate &other) const
+		{
+			return m_pthis == other.m_pthis && m_thunk == other.m_thunk;
+		}
+
+		bool operator!=(const compact_delegate &other) const
+		{
+			return !(*this == other);
+		}
+
+		bool operator<(const compact_delegate &other) const
+		{
+			return sort_key() < other.sort_key();
+		}
+
+		bool operator>(const compact_delegate &other) const
+		{
+			return other < *this;
+		}
+
+		delegate_sort_key sort_key() const
+		{
+			delegate_sort_key key;
+			key.code = reinterpret_cast<std::size_t>(m_thunk);
+			key.object = reinterpret_cast<std::size_t>(m_pthis);
+			return key;
+		}
+
+		inline void bind(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)) {
+			if(NULL == function_to_bind)
+			{
+				clear();
+				return;
+			}
+			m_pthis = fastdelegate::detail::horrible_cast<void*>(function_to_bind);
+			m_thunk = &compact_delegate::static_function_thunk;
+		}
+
+		template < class Y >
+		inline void bind(Y *pthis, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+		template < class Y >
+		inline void bind(Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+		template < class Y >
+		inline void bind(const Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = reinterpret_cast<thunk_type>(function_to_bind);
+		}
+
+#ifdef DELEGATES_ITANIUM_MFP
+		template < class X, class Y >
+		inline void bind(Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = detail::resolve_member_function(fastdelegate::detail::implicit_cast<X*>(pthis), function_to_bind, m_thunk);
+		}
+
+		template < class X, class Y >
+		inline void bind(const Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) const) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = detail::resolve_member_function(const_cast<X*>(fastdelegate::detail::implicit_cast<const X*>(pthis)), function_to_bind, m_thunk);
+		}
+#endif
+
+		template < ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+		inline void bind() {
+			m_pthis = NULL;
+			m_thunk = &compact_delegate::f_thunk_static<function_to_bind>;
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk_member<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) const >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = &compact_delegate::f_thunk_const_member<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = static_cast<void*>(pthis);
+			m_thunk = &compact_delegate::f_thunk_const<Y, function_to_bind>;
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_thunk = &compact_delegate::f_thunk_const<Y, function_to_bind>;
+		}
+
+		template < ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+		static DELEGATES_CONSTEXPR compact_delegate from() {
+			return compact_delegate(&compact_delegate::f_thunk_static<function_to_bind>, NULL);
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_member<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) const >
+		static DELEGATES_CONSTEXPR compact_delegate from(const Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const_member<Y, function_to_bind>, const_cast<void*>(static_cast<const void*>(pthis)));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const<Y, function_to_bind>, static_cast<void*>(pthis));
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+		static DELEGATES_CONSTEXPR compact_delegate from(const Y *pthis) {
+			return compact_delegate(&compact_delegate::f_thunk_const<Y, function_to_bind>, const_cast<void*>(static_cast<const void*>(pthis)));
+		}
+
+		ReturnT operator()(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7, Param8T p8) const
+		{
+			return m_thunk(m_pthis, p1, p2, p3, p4, p5, p6, p7, p8);
+		}
+
+	private:
+		typedef struct SafeBoolStruct {
+			int a_data_pointer_to_this_is_0_on_buggy_compilers;
+			thunk_type m_nonzero;
+		} UselessTypedef;
+		typedef thunk_type SafeBoolStruct::*unspecified_bool_type;
+
+	public:
+		operator unspecified_bool_type() const {
+			return empty() ? 0 : &SafeBoolStruct::m_nonzero;
+		}
+
+		inline bool operator!() const {
+			return empty();
+		}
+
+		inline bool empty() const {
+			return NULL == m_thunk;
+		}
+
+		void clear() {
+			m_pthis = NULL; m_thunk = NULL;
+		}
+
+	private:
+		void *m_pthis;
+		thunk_type m_thunk;
+
+		DELEGATES_CONSTEXPR compact_delegate(thunk_type thunk, void *pthis)
+			: m_pthis(pthis),
+			m_thunk(thunk)
+		{ }
+
+		static ReturnT static_function_thunk(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7, Param8T p8)
+		{
+			return fastdelegate::detail::horrible_cast<free_function_t>(pthis)(p1, p2, p3, p4, p5, p6, p7, p8);
+		}
+
+		template< ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+		static ReturnT f_thunk_static(void *, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7, Param8T p8)
+		{
+			return function_to_bind(p1, p2, p3, p4, p5, p6, p7, p8);
+		}
+
+		template< class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+		static ReturnT f_thunk_member(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7, Param8T p8)
+		{
+			return (static_cast<Y*>(pthis)->*function_to_bind)(p1, p2, p3, p4, p5, p6, p7, p8);
+		}
+
+		template< class Y, ReturnT(Y::*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) const >
+		static ReturnT f_thunk_const_member(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7, Param8T p8)
+		{
+			return (static_cast<const Y*>(pthis)->*function_to_bind)(p1, p2, p3, p4, p5, p6, p7, p8);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+		static ReturnT f_thunk(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7, Param8T p8)
+		{
+			return function_to_bind(static_cast<Y*>(pthis), p1, p2, p3, p4, p5, p6, p7, p8);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+		static ReturnT f_thunk_const(void *pthis, Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7, Param8T p8)
+		{
+			return function_to_bind(static_cast<const Y*>(pthis), p1, p2, p3, p4, p5, p6, p7, p8);
+		}
+	};
+
+	template <class ReturnT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T, class Param6T, class Param7T, class Param8T>
+	struct is_trivially_relocatable< compact_delegate<ReturnT, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T> >
+	{
+		static const bool value = true;
+	};
+
+	namespace detail
+	{
+		typedef int ERROR_compact_delegate_is_not_two_pointers_in_size[
+			sizeof(compact_delegate<void>) == 2 * sizeof(void*) &&
+			sizeof(compact_delegate<void, int>) == 2 * sizeof(void*) &&
+			sizeof(compact_delegate<void, int, int, int, int, int, int, int, int>) == 2 * sizeof(void*) ? 1 : -1];
+	}
+}
+
+#endif // COMPACT_DELEGATE_H
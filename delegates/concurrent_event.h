@@ -0,0 +1,358 @@
+#ifndef CONCURRENT_EVENT_H
+#define CONCURRENT_EVENT_H
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+//multicast delegate for concurrent use: lock-free broadcast of an immutable snapshot, copy-on-write subscribe/unsubscribe
+
+/******************************************************************************************************************************/
+/* 'delegates::concurrent_event<return_type(param_type1, param_type2)>' holds 'delegate<return_type(param_type1, ...)>'       */
+/* subscribers and could be called from any number of threads while other threads add and remove subscribers:                 */
+/*                                                                                                                            */
+/*   concurrent_event<void(int)> on_value;                                                                                    */
+/*                                                                                                                            */
+/*   on_value += delegate<void(int)>(&obj, &Object::set_value); // any thread                                                 */
+/*   on_value(42); // any thread, calls subscribers of the snapshot current at the start of the call, in order                */
+/*                                                                                                                            */
+/* Broadcast takes no locks and does no atomic read-modify-write: the calling thread marks its own (cache line padded) reader */
+/* record with the current epoch, loads the snapshot pointer and calls the subscribers. Writers are serialized by a mutex,    */
+/* publish a new copy of the subscriber array and retire the old one; it is deleted by a later write (or the destructor)      */
+/* once no reader that could have seen it is still inside a broadcast. Subscribers could add or remove subscribers (of any    */
+/* event) while being called. The event must not be destroyed while it is being called.                                       */
+/* Requires C++11.                                                                                                            */
+/*                                                                                                                            */
+/******************************************************************************************************************************/
+
+#include "delegate.h"
+
+#if DELEGATES_CPLUSPLUS < 201103L
+#error "concurrent_event requires C++11"
+#else
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <cstdint>
+
+namespace delegates
+{
+	namespace detail
+	{
+		// one per thread that ever called a concurrent event, reused after the thread exits, never deleted;
+		// padded so the epoch written by the owner thread does not share a cache line with anything else
+		struct epoch_reader_record
+		{
+			epoch_reader_record()
+				: epoch(0),
+				in_use(true),
+				depth(0),
+				next(NULL)
+			{ }
+
+			char padding_before[64];
+			std::atomic<std::uint64_t> epoch; // 0 when the thread is not inside a broadcast
+			std::atomic<bool> in_use;
+			unsigned depth; // nesting of broadcasts, touched by the owner thread only
+			epoch_reader_record *next;
+			char padding_after[64];
+		};
+
+		class epoch_domain
+		{
+		public:
+			static epoch_domain& instance()
+			{
+				static epoch_domain *domain = new epoch_domain(); // outlives threads still running at exit
+				return *domain;
+			}
+
+			static epoch_reader_record& this_thread_record()
+			{
+				static thread_local record_owner owner(instance().acquire_record());
+				return *owner.record;
+			}
+
+			inline void enter(epoch_reader_record &record)
+			{
+				if(record.depth++ == 0)
+				{
+					record.epoch.store(m_epoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+					// the record must be visible to writers before the snapshot pointer is read
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+				}
+			}
+
+			inline void leave(epoch_reader_record &record)
+			{
+				if(--record.depth == 0)
+					record.epoch.store(0, std::memory_order_release);
+			}
+
+			// called by the writer after publishing the new snapshot, the old one is retired with the returned epoch
+			std::uint64_t advance()
+			{
+				return m_epoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+			}
+
+			// memory retired with epoch less or equal to the returned one is not seen by any reader
+			std::uint64_t safe_epoch() const
+			{
+				std::uint64_t safe = m_epoch.load(std::memory_order_seq_cst);
+				for(epoch_reader_record *record = m_records.load(std::memory_order_seq_cst); record; record = record->next)
+				{
+					const std::uint64_t epoch = record->epoch.load(std::memory_order_seq_cst);
+					if(epoch != 0 && epoch < safe)
+						safe = epoch;
+				}
+				return safe;
+			}
+
+		private:
+			struct record_owner
+			{
+				explicit record_owner(epoch_reader_record *record)
+					: record(record)
+				{ }
+
+				~record_owner()
+				{
+					record->in_use.store(false, std::memory_order_release);
+				}
+
+				epoch_reader_record *record;
+			};
+
+			epoch_domain()
+				: m_epoch(1),
+				m_records(NULL)
+			{ }
+
+			epoch_reader_record* acquire_record()
+			{
+				for(epoch_reader_record *record = m_records.load(std::memory_order_acquire); record; record = record->next)
+				{
+					bool expected = false;
+					if(!record->in_use.load(std::memory_order_relaxed) &&
+						record->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire))
+						return record;
+				}
+
+				epoch_reader_record *record = new epoch_reader_record();
+				record->next = m_records.load(std::memory_order_relaxed);
+				while(!m_records.compare_exchange_weak(record->next, record, std::memory_order_seq_cst, std::memory_order_relaxed));
+				return record;
+			}
+
+			std::atomic<std::uint64_t> m_epoch;
+			std::atomic<epoch_reader_record*> m_records;
+		};
+
+		struct epoch_read_section
+		{
+			epoch_read_section()
+				: domain(epoch_domain::instance()),
+				record(epoch_domain::this_thread_record())
+			{
+				domain.enter(record);
+			}
+
+			~epoch_read_section()
+			{
+				domain.leave(record);
+			}
+
+			epoch_domain &domain;
+			epoch_reader_record &record;
+
+		private:
+			epoch_read_section(const epoch_read_section&);
+			void operator=(const epoch_read_section&);
+		};
+	}
+
+	template<class SignatureT>
+	class concurrent_event;
+
+	template<class ReturnT, class... ParamsT>
+	class concurrent_event<ReturnT(ParamsT...)>
+	{
+	public:
+		typedef concurrent_event type;
+		typedef delegate<ReturnT(ParamsT...)> delegate_type;
+
+		concurrent_event()
+			: m_snapshot(NULL),
+			m_retired(NULL)
+		{ }
+
+		~concurrent_event()
+		{
+			delete m_snapshot.load(std::memory_order_relaxed);
+			while(m_retired)
+			{
+				snapshot *next = m_retired->next_retired;
+				delete m_retired;
+				m_retired = next;
+			}
+		}
+
+		void add(const delegate_type &subscriber)
+		{
+			if(subscriber.empty())
+				return;
+
+			std::lock_guard<std::mutex> lock(m_write_mutex);
+
+			const snapshot *current = m_snapshot.load(std::memory_order_relaxed);
+			snapshot *updated = new snapshot();
+			try
+			{
+				if(current)
+				{
+					updated->subscribers.reserve(current->subscribers.size() + 1);
+					updated->subscribers = current->subscribers;
+				}
+				updated->subscribers.push_back(subscriber);
+			}
+			catch(...)
+			{
+				delete updated;
+				throw;
+			}
+			publish(updated);
+		}
+
+		bool remove(const delegate_type &subscriber)
+		{
+			std::lock_guard<std::mutex> lock(m_write_mutex);
+
+			const snapshot *current = m_snapshot.load(std::memory_order_relaxed);
+			if(!current)
+				return false;
+
+			for(std::size_t i = current->subscribers.size(); i-- > 0;)
+			{
+				if(current->subscribers[i] == subscriber)
+				{
+					snapshot *updated = NULL;
+					if(current->subscribers.size() > 1)
+					{
+						updated = new snapshot();
+						try
+						{
+							updated->subscribers.reserve(current->subscribers.size() - 1);
+							updated->subscribers.insert(updated->subscribers.end(), current->subscribers.begin(), current->subscribers.begin() + i);
+							updated->subscribers.insert(updated->subscribers.end(), current->subscribers.begin() + i + 1, current->subscribers.end());
+						}
+						catch(...)
+						{
+							delete updated;
+							throw;
+						}
+					}
+					publish(updated);
+					return true;
+				}
+			}
+			return false;
+		}
+
+		void clear()
+		{
+			std::lock_guard<std::mutex> lock(m_write_mutex);
+
+			if(m_snapshot.load(std::memory_order_relaxed))
+				publish(NULL);
+		}
+
+		concurrent_event& operator+=(const delegate_type &subscriber)
+		{
+			add(subscriber);
+			return *this;
+		}
+
+		concurrent_event& operator-=(const delegate_type &subscriber)
+		{
+			remove(subscriber);
+			return *this;
+		}
+
+		template<class... ArgsT>
+		void operator()(ArgsT&&... args) const
+		{
+			detail::epoch_read_section section;
+
+			const snapshot *current = m_snapshot.load(std::memory_order_acquire);
+			if(!current)
+				return;
+
+			const delegate_type *subscribers = current->subscribers.data();
+			const std::size_t count = current->subscribers.size();
+			for(std::size_t i = 0; i < count; ++i)
+				subscribers[i](args...);
+		}
+
+		std::size_t size() const
+		{
+			detail::epoch_read_section section;
+
+			const snapshot *current = m_snapshot.load(std::memory_order_acquire);
+			return current ? current->subscribers.size() : 0;
+		}
+
+		bool empty() const
+		{
+			return NULL == m_snapshot.load(std::memory_order_acquire);
+		}
+
+	private:
+		struct snapshot
+		{
+			std::vector<delegate_type> subscribers;
+			std::uint64_t retire_epoch;
+			snapshot *next_retired;
+		};
+
+		std::atomic<const snapshot*> m_snapshot; // NULL when there are no subscribers
+		snapshot *m_retired; // guarded by 'm_write_mutex', newest first
+		std::mutex m_write_mutex;
+
+		concurrent_event(const concurrent_event&);
+		void operator=(const concurrent_event&);
+
+		// with 'm_write_mutex' locked
+		void publish(snapshot *updated)
+		{
+			detail::epoch_domain &domain = detail::epoch_domain::instance();
+
+			snapshot *previous = const_cast<snapshot*>(m_snapshot.load(std::memory_order_relaxed));
+			m_snapshot.store(updated, std::memory_order_seq_cst);
+
+			if(previous)
+			{
+				previous->retire_epoch = domain.advance();
+				previous->next_retired = m_retired;
+				m_retired = previous;
+			}
+
+			const std::uint64_t safe = domain.safe_epoch();
+			snapshot **link = &m_retired;
+			while(*link)
+			{
+				if((*link)->retire_epoch <= safe)
+				{
+					snapshot *reclaimed = *link;
+					*link = reclaimed->next_retired;
+					delete reclaimed;
+				}
+				else
+					link = &(*link)->next_retired;
+			}
+		}
+	};
+}
+
+#endif // DELEGATES_CPLUSPLUS < 201103L
+
+#endif // CONCURRENT_EVENT_H
@@ -0,0 +1,94 @@
+#ifndef DEFERRED_CALL_H
+#define DEFERRED_CALL_H
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+//delegate stored together with the arguments it is going to be called with, used by the queues of deferred calls
+
+#include "delegate.h"
+
+#if DELEGATES_CPLUSPLUS < 201103L
+#error "deferred_call requires C++11"
+#else
+
+#include <tuple>
+#include <new>
+
+namespace delegates
+{
+	namespace detail
+	{
+		template<std::size_t... IndicesT>
+		struct index_sequence
+		{ };
+
+		template<std::size_t CountT, std::size_t... IndicesT>
+		struct make_index_sequence :
+			make_index_sequence<CountT - 1, CountT - 1, IndicesT...>
+		{ };
+
+		template<std::size_t... IndicesT>
+		struct make_index_sequence<0, IndicesT...>
+		{
+			typedef index_sequence<IndicesT...> type;
+		};
+
+		// copies of the arguments (the empty base for no arguments) are moved into the call, so it is called once
+		template<class SignatureT>
+		class deferred_call;
+
+		template<class ReturnT, class... ParamsT>
+		class deferred_call<ReturnT(ParamsT...)> :
+			private std::tuple<typename std::decay<ParamsT>::type...>
+		{
+			typedef std::tuple<typename std::decay<ParamsT>::type...> arguments_type;
+
+		public:
+			typedef delegate<ReturnT(ParamsT...)> delegate_type;
+
+			template<class... ArgsT>
+			explicit deferred_call(const delegate_type &target, ArgsT&&... args)
+				: arguments_type(std::forward<ArgsT>(args)...),
+				m_target(target)
+			{ }
+
+			inline ReturnT run()
+			{
+				return run(typename make_index_sequence<sizeof...(ParamsT)>::type());
+			}
+
+		private:
+			delegate_type m_target;
+
+			template<std::size_t... IndicesT>
+			inline ReturnT run(index_sequence<IndicesT...>)
+			{
+				return m_target(std::forward<ParamsT>(std::get<IndicesT>(static_cast<arguments_type&>(*this)))...);
+			}
+		};
+
+		// raw storage for a call that is not constructed yet (calls are not default constructible)
+		template<class CallT>
+		struct call_storage
+		{
+			typename std::aligned_storage<sizeof(CallT), std::alignment_of<CallT>::value>::type bytes;
+
+			inline CallT& get()
+			{
+				return *reinterpret_cast<CallT*>(&bytes);
+			}
+
+			// moves the call to the other (empty) storage, this one becomes empty
+			inline void move_to(call_storage &to)
+			{
+				new(&to.bytes) CallT(std::move(get()));
+				get().~CallT();
+			}
+		};
+	}
+}
+
+#endif // DELEGATES_CPLUSPLUS < 201103L
+
+#endif // DEFERRED_CALL_H
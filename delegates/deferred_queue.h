@@ -0,0 +1,188 @@
+#ifndef DEFERRED_QUEUE_H
+#define DEFERRED_QUEUE_H
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+//bounded lock-free queue of deferred calls: many threads post delegates with arguments, one thread calls them
+
+/******************************************************************************************************************************/
+/* 'delegates::deferred_queue<return_type(param_type1, param_type2)>' is a ring of slots, each holding                        */
+/* 'delegate<return_type(param_type1, ...)>' together with copies of the arguments; any thread posts calls, one thread (the   */
+/* consumer, e.g. an event loop) makes them:                                                                                  */
+/*                                                                                                                            */
+/*   deferred_queue<void(int, std::string)> calls(1024);                                                                      */
+/*                                                                                                                            */
+/*   calls.post(delegate<void(int, std::string)>(&window, &Window::set_title), id, title); // any thread, false if full       */
+/*   calls.drain(); // consumer thread, makes the posted calls in the order they were posted, returns their number            */
+/*                                                                                                                            */
+/* Producers construct the call, claim a slot with one compare-and-swap of the tail, move the call into it and publish it     */
+/* with the slot sequence number (bounded queue of D. Vyukov); the consumer walks the ready slots, calls and destroys the     */
+/* calls in place and hands the slots back. Nothing is allocated after the constructor. A full queue is not grown: 'post'     */
+/* returns false and the producer decides whether to retry, drop or do the call itself. The consumer is not woken by 'post',  */
+/* it calls 'drain' when it polls (or when the producer signals it by other means). Returned values are discarded. If a call  */
+/* throws, the exception leaves 'drain' and the rest of the calls stay queued. Moves of the arguments must not throw.         */
+/* Requires C++11.                                                                                                            */
+/*                                                                                                                            */
+/******************************************************************************************************************************/
+
+#include "deferred_call.h"
+
+#if DELEGATES_CPLUSPLUS < 201103L
+#error "deferred_queue requires C++11"
+#else
+
+#include <atomic>
+#include <vector>
+
+namespace delegates
+{
+	template<class SignatureT>
+	class deferred_queue;
+
+	template<class ReturnT, class... ParamsT>
+	class deferred_queue<ReturnT(ParamsT...)>
+	{
+	public:
+		typedef deferred_queue type;
+		typedef delegate<ReturnT(ParamsT...)> delegate_type;
+
+		// 'capacity' is rounded up to the power of 2, at least 2: with one slot the sequence number of the call ready at
+		// 'position' would be the one of the slot free for 'position + 1'
+		explicit deferred_queue(std::size_t capacity)
+			: m_slots(round_up_to_power_of_2(capacity)),
+			m_mask(m_slots.size() - 1),
+			m_head(0),
+			m_tail(0)
+		{
+			for(std::size_t i = 0; i < m_slots.size(); ++i)
+				m_slots[i].sequence.store(i, std::memory_order_relaxed);
+		}
+
+		~deferred_queue()
+		{
+			for(; ready(m_head); ++m_head)
+				release(m_slots[m_head & m_mask]);
+		}
+
+		// any thread; 'args' are copied (moved) into the slot and moved into the call
+		template<class... ArgsT>
+		bool post(const delegate_type &call_to_make, ArgsT&&... args)
+		{
+			if(call_to_make.empty())
+				return false;
+
+			// constructed before a slot is claimed: once claimed, the slot must be published
+			detail::call_storage<call_type> posted;
+			new(&posted.bytes) call_type(call_to_make, std::forward<ArgsT>(args)...);
+
+			std::size_t tail = m_tail.load(std::memory_order_relaxed);
+			for(;;)
+			{
+				slot &claimed = m_slots[tail & m_mask];
+				const std::ptrdiff_t lag = static_cast<std::ptrdiff_t>(claimed.sequence.load(std::memory_order_acquire) - tail);
+				if(lag < 0) // the consumer has not handed the slot back yet
+				{
+					posted.get().~call_type();
+					return false;
+				}
+				if(0 == lag && m_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed))
+				{
+					posted.move_to(claimed.call);
+					claimed.sequence.store(tail + 1, std::memory_order_release);
+					return true;
+				}
+				if(lag > 0) // other producer claimed it
+					tail = m_tail.load(std::memory_order_relaxed);
+			}
+		}
+
+		// consumer thread only: makes up to 'max_count' calls that are ready, in the order they were posted, returns their number
+		std::size_t drain(std::size_t max_count = static_cast<std::size_t>(-1))
+		{
+			std::size_t count = 0;
+			while(count < max_count && ready(m_head))
+			{
+				slot &current = m_slots[m_head & m_mask];
+				slot_guard guard(*this, current); // hands the slot back even if the call throws
+				++count;
+				current.call.get().run();
+			}
+			return count;
+		}
+
+		// consumer thread only: true if no call is ready (a call being posted could become ready right after)
+		bool empty() const
+		{
+			return !ready(m_head);
+		}
+
+		inline std::size_t capacity() const
+		{
+			return m_slots.size();
+		}
+
+	private:
+		typedef detail::deferred_call<ReturnT(ParamsT...)> call_type;
+
+		struct slot
+		{
+			// 'position' when free for the producer posting at 'position',
+			// 'position + 1' when the call posted at 'position' is ready for the consumer
+			std::atomic<std::size_t> sequence;
+			detail::call_storage<call_type> call;
+		};
+
+		struct slot_guard
+		{
+			slot_guard(deferred_queue &queue, slot &current)
+				: queue(queue),
+				current(current)
+			{ }
+
+			~slot_guard()
+			{
+				queue.release(current);
+				++queue.m_head;
+			}
+
+			deferred_queue &queue;
+			slot &current;
+		};
+
+		std::vector<slot> m_slots;
+		const std::size_t m_mask;
+		char m_padding_before[64];
+		std::size_t m_head; // touched by the consumer only
+		char m_padding_between[64];
+		std::atomic<std::size_t> m_tail; // claimed by producers
+		char m_padding_after[64];
+
+		deferred_queue(const deferred_queue&);
+		void operator=(const deferred_queue&);
+
+		inline bool ready(std::size_t position) const
+		{
+			return m_slots[position & m_mask].sequence.load(std::memory_order_acquire) == position + 1;
+		}
+
+		// destroys the call, the slot is free for the producer that is going to post at 'm_head + capacity'
+		inline void release(slot &current)
+		{
+			current.call.get().~call_type();
+			current.sequence.store(m_head + m_slots.size(), std::memory_order_release);
+		}
+
+		static std::size_t round_up_to_power_of_2(std::size_t capacity)
+		{
+			std::size_t result = 2;
+			while(result < capacity)
+				result <<= 1;
+			return result;
+		}
+	};
+}
+
+#endif // DELEGATES_CPLUSPLUS < 201103L
+
+#endif // DEFERRED_QUEUE_H
@@ -18,6 +18,9 @@
 /*   4) { this_type pthis, return_type function(const this_type param1, param_type1 param2, param_type2 param3); }            */
 /*   5) { const this_type pthis, return_type this_type::member_function const (param_type1 param1, param_type2 param2); }     */
 /*                                                                                                                            */
+/* 2) and 4) could also be bound at compile time with 'bind<this_type, &function>(pthis)' (or 'bind<&function>(pthis)' in     */
+/* C++17) so the call does not go through the proxy and costs exactly one indirect call.                                      */
+/*                                                                                                                            */
 /******************************************************************************************************************************/
 
 #include "FastDelegate.h"
@@ -27,42 +30,306 @@
 #include <cstring>
 #include <cassert>
 
+#if defined(_MSVC_LANG) && _MSVC_LANG > __cplusplus
+#define DELEGATES_CPLUSPLUS _MSVC_LANG
+#else
+#define DELEGATES_CPLUSPLUS __cplusplus
+#endif
+
+#if DELEGATES_CPLUSPLUS >= 201103L
+#include <type_traits>
+#include <functional>
+#define DELEGATES_NOEXCEPT noexcept
+#define DELEGATES_CONSTEXPR constexpr
+#else
+#define DELEGATES_NOEXCEPT
+#define DELEGATES_CONSTEXPR
+#endif
+
+// Compilers using the Itanium C++ ABI member function pointers ({ptr, adj} pair) where member function
+// takes 'this' as its first argument, so a member function could be called as a free function.
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(_WIN32) && (defined(__x86_64__) || defined(__aarch64__))
+#define DELEGATES_ITANIUM_MFP
+#endif
+
 namespace delegates
 {
+	// fixed width key of the bound target: the code word is compared first, then the object word it is called with.
+	// Delegates are ordered by this key first (see 'delegate::sort_key'), so it could be used for radix sorting.
+	struct delegate_sort_key
+	{
+		std::size_t code;
+		std::size_t object;
+
+		bool operator==(const delegate_sort_key &other) const
+		{
+			return code == other.code && object == other.object;
+		}
+
+		bool operator!=(const delegate_sort_key &other) const
+		{
+			return !(*this == other);
+		}
+
+		bool operator<(const delegate_sort_key &other) const
+		{
+			if(code != other.code)
+				return code < other.code;
+			return object < other.object;
+		}
+	};
+
 	namespace detail
 	{
 		typedef fastdelegate::detail::DefaultVoid DefaultVoid;
 
+#ifdef DELEGATES_ITANIUM_MFP
+		// Itanium member function pointer: 
+		//   'ptr' is the function address or (1 + vtable offset) for virtual functions on x86-64,
+		//   'adj' is the 'this' adjustment (doubled, with virtual flag in the low bit on ARM).
+		struct ItaniumMemFuncPtr
+		{
+			std::size_t ptr;
+			std::ptrdiff_t adj;
+		};
+#endif
+
 		struct DelegateMementoHack :
 			public fastdelegate::DelegateMemento
 		{
+			template<class Y>
 			static
-			void copy_pthis(fastdelegate::DelegateMemento &memento_to, const fastdelegate::DelegateMemento &memento_from)
+			void set_pthis(fastdelegate::DelegateMemento &memento, const Y *pthis)
 			{
-				memento_to.*(&DelegateMementoHack::m_pthis) = memento_from.*(&DelegateMementoHack::m_pthis);
+				memento.*(&DelegateMementoHack::m_pthis) = 
+					reinterpret_cast<fastdelegate::detail::GenericClass*>(const_cast<Y*>(pthis));
 			}
 
+			// the mementos are compared and hashed in place ignoring 'this', no copies are made
+
 			static
 			bool is_equal_pFunction(const fastdelegate::DelegateMemento &memento1, const fastdelegate::DelegateMemento &memento2)
 			{
-				fastdelegate::DelegateMemento 
-					lhs(memento1), rhs(memento2);
-				lhs.*(&DelegateMementoHack::m_pthis) = NULL;
-				rhs.*(&DelegateMementoHack::m_pthis) = NULL;
-				return lhs.IsEqual(rhs);
+#if !defined(FASTDELEGATE_USESTATICFUNCTIONHACK)
+				if(memento1.*(&DelegateMementoHack::m_pStaticFunction) != memento2.*(&DelegateMementoHack::m_pStaticFunction))
+					return false;
+#endif
+				return memento1.*(&DelegateMementoHack::m_pFunction) == memento2.*(&DelegateMementoHack::m_pFunction);
 			}
 
 			static
 			bool is_less_pFunction(const fastdelegate::DelegateMemento &memento1, const fastdelegate::DelegateMemento &memento2)
 			{
-				fastdelegate::DelegateMemento 
-					lhs(memento1), rhs(memento2);
-				lhs.*(&DelegateMementoHack::m_pthis) = NULL;
-				rhs.*(&DelegateMementoHack::m_pthis) = NULL;
-				return lhs.IsLess(rhs);
+#if !defined(FASTDELEGATE_USESTATICFUNCTIONHACK)
+				if(memento1.*(&DelegateMementoHack::m_pStaticFunction) != 0 || memento2.*(&DelegateMementoHack::m_pStaticFunction) != 0)
+					return memento1.*(&DelegateMementoHack::m_pStaticFunction) < memento2.*(&DelegateMementoHack::m_pStaticFunction);
+#endif
+				return std::memcmp(&(memento1.*(&DelegateMementoHack::m_pFunction)), &(memento2.*(&DelegateMementoHack::m_pFunction)), sizeof(GenericMemFuncType)) < 0;
+			}
+
+			static
+			std::size_t hash_combine(std::size_t seed, std::size_t value)
+			{
+				return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+			}
+
+			// consistent with 'is_equal_pFunction'
+			static
+			std::size_t hash_pFunction(const fastdelegate::DelegateMemento &memento)
+			{
+				const unsigned char *bytes = 
+					reinterpret_cast<const unsigned char*>(&(memento.*(&DelegateMementoHack::m_pFunction)));
+				std::size_t seed = 0;
+				for(std::size_t i = 0; i + sizeof(std::size_t) <= sizeof(GenericMemFuncType); i += sizeof(std::size_t))
+				{
+					std::size_t word;
+					std::memcpy(&word, bytes + i, sizeof(word));
+					seed = hash_combine(seed, word);
+				}
+#if !defined(FASTDELEGATE_USESTATICFUNCTIONHACK)
+				seed = hash_combine(seed, reinterpret_cast<std::size_t>(memento.*(&DelegateMementoHack::m_pStaticFunction)));
+#endif
+				return seed;
+			}
+
+			// consistent with 'DelegateMemento::IsEqual'
+			static
+			std::size_t hash(const fastdelegate::DelegateMemento &memento)
+			{
+				std::size_t seed = hash_pFunction(memento);
+#if !defined(FASTDELEGATE_USESTATICFUNCTIONHACK)
+				if(0 == memento.*(&DelegateMementoHack::m_pStaticFunction))
+					return seed;
+#endif
+				return hash_combine(seed, reinterpret_cast<std::size_t>(memento.*(&DelegateMementoHack::m_pthis)));
+			}
+
+			// code address (or the first word of member function pointer) and the object it is called with
+			static
+			delegate_sort_key sort_key(const fastdelegate::DelegateMemento &memento)
+			{
+				delegate_sort_key key;
+#if !defined(FASTDELEGATE_USESTATICFUNCTIONHACK)
+				if(0 != memento.*(&DelegateMementoHack::m_pStaticFunction))
+				{
+					key.code = reinterpret_cast<std::size_t>(memento.*(&DelegateMementoHack::m_pStaticFunction));
+					key.object = 0; // 'this' is the delegate itself
+					return key;
+				}
+#endif
+				std::memcpy(&key.code, &(memento.*(&DelegateMementoHack::m_pFunction)), sizeof(key.code));
+				key.object = reinterpret_cast<std::size_t>(memento.*(&DelegateMementoHack::m_pthis));
+#ifdef DELEGATES_ITANIUM_MFP
+				ItaniumMemFuncPtr mfp;
+				std::memcpy(&mfp, &(memento.*(&DelegateMementoHack::m_pFunction)), sizeof(mfp));
+#if defined(__aarch64__)
+				key.object += mfp.adj >> 1;
+#else
+				key.object += mfp.adj;
+#endif
+#endif
+				return key;
+			}
+
+			// object and member function pointer the delegate calls, 'MemFuncT' is the member function type of 'GenericClass'
+			// with the signature of the delegate
+			template<class MemFuncT>
+			static
+			fastdelegate::detail::GenericClass* get_closure(const fastdelegate::DelegateMemento &memento, MemFuncT &function)
+			{
+				std::memcpy(&function, &(memento.*(&DelegateMementoHack::m_pFunction)), sizeof(function));
+				return memento.*(&DelegateMementoHack::m_pthis);
+			}
+
+			// 'FastDelegateN::GetMemento' is not const but does not modify anything
+			template<class FastDelegateT>
+			static
+			const fastdelegate::DelegateMemento& get_memento(const FastDelegateT &delegate_from)
+			{
+				return const_cast<FastDelegateT&>(delegate_from).GetMemento();
+			}
+
+			// binds free function taking object pointer as if it was a member function of that object,
+			// so the memento does not reference the delegate and could be copied bitwise
+			template<class DelegateT, class Y, class FuncPtrT>
+			static
+			bool bind_free_function(DelegateT &delegate_to, const Y *pthis, FuncPtrT function_to_bind)
+			{
+#ifdef DELEGATES_ITANIUM_MFP
+				ItaniumMemFuncPtr mfp;
+				mfp.ptr = reinterpret_cast<std::size_t>(function_to_bind);
+				mfp.adj = 0;
+				// hide the address from optimizer so it does not warn about never taken virtual call branch
+				__asm__("" : "+r"(mfp.ptr));
+#if !defined(__aarch64__)
+				if(mfp.ptr & 1) // would be taken for virtual function
+					return false;
+#endif
+				fastdelegate::DelegateMemento memento;
+				memento.*(&DelegateMementoHack::m_pthis) = 
+					reinterpret_cast<fastdelegate::detail::GenericClass*>(const_cast<Y*>(pthis));
+				std::memcpy(&(memento.*(&DelegateMementoHack::m_pFunction)), &mfp, sizeof(mfp));
+				delegate_to.SetMemento(memento);
+				return true;
+#else
+				(void) delegate_to; (void) pthis; (void) function_to_bind;
+				return false;
+#endif
+			}
+		};
+
+#ifdef DELEGATES_ITANIUM_MFP
+		// resolves member function pointer to the actual code address for this object
+		// (looks up the vtable once for virtual functions) and returns adjusted 'this'
+		template<class X, class XMemFunc, class FuncPtrT>
+		inline void* resolve_member_function(X *pthis, XMemFunc function_to_bind, FuncPtrT &code)
+		{
+#if DELEGATES_CPLUSPLUS >= 201103L
+			static_assert(sizeof(XMemFunc) == sizeof(ItaniumMemFuncPtr), "Unsupported member function pointer on this compiler");
+#else
+			typedef int ERROR_Unsupported_member_function_pointer_on_this_compiler[sizeof(XMemFunc) == sizeof(ItaniumMemFuncPtr) ? 1 : -1];
+			(void) sizeof(ERROR_Unsupported_member_function_pointer_on_this_compiler);
+#endif
+
+			ItaniumMemFuncPtr mfp;
+			std::memcpy(&mfp, &function_to_bind, sizeof(mfp));
+#if defined(__aarch64__)
+			char *adjusted_this = reinterpret_cast<char*>(pthis) + (mfp.adj >> 1);
+			const bool is_virtual = (mfp.adj & 1) != 0;
+			const std::size_t vtable_offset = mfp.ptr;
+#else
+			char *adjusted_this = reinterpret_cast<char*>(pthis) + mfp.adj;
+			const bool is_virtual = (mfp.ptr & 1) != 0;
+			const std::size_t vtable_offset = mfp.ptr - 1;
+#endif
+			std::size_t address = mfp.ptr;
+			if(is_virtual)
+			{
+				const char *vtable;
+				std::memcpy(&vtable, adjusted_this, sizeof(vtable));
+				std::memcpy(&address, vtable + vtable_offset, sizeof(address));
 			}
+			code = reinterpret_cast<FuncPtrT>(address);
+			return adjusted_this;
+		}
+#endif
+
+		// binds member function to the code address it resolves to for this object (the final overrider for virtual
+		// function), so calls skip the vtable lookup; returns false if it could not be done on this compiler
+		template<class DelegateT, class X, class XMemFunc>
+		inline bool bind_devirtualized(DelegateT &delegate_to, X *pthis, XMemFunc function_to_bind)
+		{
+#ifdef DELEGATES_ITANIUM_MFP
+			typedef void(*code_type)();
+
+			code_type code;
+			void *adjusted_this = resolve_member_function(pthis, function_to_bind, code);
+			return DelegateMementoHack::bind_free_function(delegate_to, adjusted_this, code);
+#else
+			(void) delegate_to; (void) pthis; (void) function_to_bind;
+			return false;
+#endif
+		}
+	}
+
+#if DELEGATES_CPLUSPLUS >= 201103L
+	namespace detail
+	{
+		// captureless lambda (or other class object) convertible to the plain function pointer
+		template<class LambdaT, class FunctionT>
+		struct is_function_convertible :
+			std::integral_constant<bool, std::is_class<LambdaT>::value && std::is_convertible<const LambdaT&, FunctionT>::value>
+		{ };
+
+		// functor (lambda) with 'operator()' that could be taken as 'MemFuncT' - the exact signature is picked
+		// from overloaded and template 'operator()'
+		template<class FunctorT, class MemFuncT>
+		struct has_call_operator
+		{
+			template<class U>
+			static char test(decltype(static_cast<MemFuncT>(&U::operator()))*);
+			template<class U>
+			static long test(...);
+
+			static const bool value = sizeof(test<FunctorT>(0)) == sizeof(char);
 		};
 	}
+#endif
+
+	// 'value' is true if object of type T could be moved to the other place in memory with plain 'memcpy'
+	// (so containers could grow or sort arrays of T without calling copy constructors).
+	// 'delegate' is not: binding to free function taking object falls back to the proxy bound to the delegate itself
+	// when the function could not be called as member function (see 'DelegateMementoHack::bind_free_function').
+	template<class T>
+	struct is_trivially_relocatable
+#if DELEGATES_CPLUSPLUS >= 201103L
+		: std::integral_constant<bool, std::is_trivially_copyable<T>::value>
+	{ };
+#else
+	{
+		static const bool value = false;
+	};
+#endif
 
 	template <
 		class ReturnT = detail::DefaultVoid,
@@ -137,26 +404,32 @@ namespace delegates
 		template < class Y >
 		delegate(Y *pthis,
 			ReturnT(*function_to_bind)(Y* ))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 		template < class Y >
 		delegate(Y *pthis,
 			ReturnT(*function_to_bind)(const Y* ))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 		template < class Y >
 		delegate(const Y *pthis,
 			ReturnT(*function_to_bind)(const Y*))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 
 		delegate(ReturnT(*function_to_bind)( ))
@@ -167,43 +440,80 @@ namespace delegates
 			assert(NULL != function_to_bind);
 		}
 
-		delegate(const delegate &other)
-		{ 
-			{
-				f_proxy_type proxy = &delegate::f_proxy<delegate>;
-				base_type::bind(this, proxy);
-				fastdelegate::DelegateMemento tmp = (base_type(other)).GetMemento();
-				if(other.m_free_func)
-					detail::DelegateMementoHack::copy_pthis(tmp, base_type::GetMemento());
-				base_type::SetMemento(tmp);
-			}
-			using namespace std;
-			memcpy(&m_pthis, &other.m_pthis, sizeof(m_pthis));
-			memcpy(&m_free_func, &other.m_free_func, sizeof(m_free_func));
+		delegate(const delegate &other) DELEGATES_NOEXCEPT
+			: base_type(other),
+			m_pthis(other.m_pthis),
+			m_free_func(other.m_free_func)
+		{
+			if(m_free_func)
+				rebind_proxy();
 		}
 
-		void operator=(const delegate &other)
+		void operator=(const delegate &other) DELEGATES_NOEXCEPT
 		{
-			{
-				f_proxy_type proxy = &delegate::f_proxy<delegate>;
-				base_type::bind(this, proxy);
-				fastdelegate::DelegateMemento tmp = (base_type(other)).GetMemento();
-				if(other.m_free_func)
-					detail::DelegateMementoHack::copy_pthis(tmp, base_type::GetMemento());
-				base_type::SetMemento(tmp);
-			}
-			using namespace std;
-			memcpy(&m_pthis, &other.m_pthis, sizeof(m_pthis));
-			memcpy(&m_free_func, &other.m_free_func, sizeof(m_free_func));
+			base_type::operator=(other);
+			m_pthis = other.m_pthis;
+			m_free_func = other.m_free_func;
+			if(m_free_func)
+				rebind_proxy();
+		}
+
+#if DELEGATES_CPLUSPLUS >= 201103L
+		delegate(delegate &&other) DELEGATES_NOEXCEPT
+			: base_type(other),
+			m_pthis(other.m_pthis),
+			m_free_func(other.m_free_func)
+		{
+			if(m_free_func)
+				rebind_proxy();
+		}
+
+		void operator=(delegate &&other) DELEGATES_NOEXCEPT
+		{
+			operator=(static_cast<const delegate&>(other));
+		}
+
+		// captureless lambda is bound as static function
+		template < class LambdaT >
+		delegate(const LambdaT &lambda,
+			typename std::enable_if<detail::is_function_convertible<LambdaT, ReturnT(*)()>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(lambda);
 		}
 
+		// functor (lambda with captures) is bound by pointer as its 'operator()', so it should outlive the delegate
+		template < class FunctorT >
+		delegate(const FunctorT *functor,
+			typename std::enable_if<detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)() const>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(functor);
+		}
+
+		template < class FunctorT >
+		delegate(FunctorT *functor,
+			typename std::enable_if<!detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)() const>::value &&
+				detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)()>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(functor);
+		}
+#endif
+
 		bool operator==(const delegate &other) const 
 		{
 			if(!m_free_func && !other.m_free_func)
 				return ( static_cast<const base_type&>(*this) == static_cast<const base_type&>(other) );
 			
 			if(m_pthis == other.m_pthis && m_free_func == other.m_free_func)
-				return detail::DelegateMementoHack::is_equal_pFunction((base_type(*this)).GetMemento(), (base_type(other)).GetMemento());
+				return detail::DelegateMementoHack::is_equal_pFunction(detail::DelegateMementoHack::get_memento(*this), detail::DelegateMementoHack::get_memento(other));
 			else
 				return false;
 		}
@@ -215,48 +525,74 @@ namespace delegates
 
 		bool operator<(const delegate &other) const 
 		{
+			const delegate_sort_key key = sort_key(), other_key = other.sort_key();
+			if(key != other_key)
+				return key < other_key;
 			if(!m_free_func && !other.m_free_func)
 				return ( static_cast<const base_type&>(*this) < static_cast<const base_type&>(other) );
 			if(m_pthis != other.m_pthis)
 				return m_pthis < other.m_pthis;
 			if(m_free_func != other.m_free_func)
 				return m_free_func < other.m_free_func;
-			return detail::DelegateMementoHack::is_less_pFunction((base_type(*this)).GetMemento(), (base_type(other)).GetMemento());
+			return detail::DelegateMementoHack::is_less_pFunction(detail::DelegateMementoHack::get_memento(*this), detail::DelegateMementoHack::get_memento(other));
 		}
 
 		bool operator>(const delegate &other) const 
 		{
-			if(!m_free_func && !other.m_free_func)
-				return ( static_cast<const base_type&>(*this) > static_cast<const base_type&>(other) );
-			if(m_pthis != other.m_pthis)
-				return m_pthis > other.m_pthis;
-			if(m_free_func != other.m_free_func)
-				return m_free_func > other.m_free_func;
-			return detail::DelegateMementoHack::is_less_pFunction((base_type(other)).GetMemento(), (base_type(*this)).GetMemento());
+			return other < *this;
+		}
+
+		std::size_t hash() const
+		{
+			const fastdelegate::DelegateMemento &memento = detail::DelegateMementoHack::get_memento(*this);
+			if(!m_free_func)
+				return detail::DelegateMementoHack::hash(memento);
+			std::size_t seed = detail::DelegateMementoHack::hash_pFunction(memento);
+			seed = detail::DelegateMementoHack::hash_combine(seed, reinterpret_cast<std::size_t>(m_pthis));
+			return detail::DelegateMementoHack::hash_combine(seed, reinterpret_cast<std::size_t>(m_free_func));
+		}
+
+		delegate_sort_key sort_key() const
+		{
+			if(!m_free_func)
+				return detail::DelegateMementoHack::sort_key(detail::DelegateMementoHack::get_memento(*this));
+			delegate_sort_key key;
+			key.code = reinterpret_cast<std::size_t>(m_free_func);
+			key.object = reinterpret_cast<std::size_t>(m_pthis);
+			return key;
 		}
 
 		template < class Y >
 		inline void bind(Y *pthis, ReturnT(*function_to_bind)(Y* )) {
 			this->clear();
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
 			m_pthis = static_cast<void*>(pthis);
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class Y >
 		inline void bind(Y *pthis, ReturnT(*function_to_bind)(const Y* )) {
 			this->clear();
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
 			m_pthis = static_cast<void*>(pthis);
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class Y >
 		inline void bind(const Y *pthis, ReturnT(*function_to_bind)(const Y*)) {
 			this->clear();
-			m_pthis = static_cast<void*>(pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class X, class Y >
@@ -275,17 +611,89 @@ namespace delegates
 			base_type::bind(pthis, function_to_bind);
 		}
 
+		// virtual function is resolved for 'pthis' once here instead of on every call,
+		// so 'pthis' must not change its dynamic type while bound (same as 'bind' if not supported by compiler)
+		template < class X, class Y >
+		inline void bind_devirtualized(Y *pthis, ReturnT(X::* function_to_bind)()) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::bind_devirtualized(*this, fastdelegate::detail::implicit_cast<X*>(pthis), function_to_bind))
+				return;
+			base_type::bind(pthis, function_to_bind);
+		}
+
+		template < class X, class Y >
+		inline void bind_devirtualized(const Y *pthis, ReturnT(X::* function_to_bind)() const) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::bind_devirtualized(*this, const_cast<X*>(fastdelegate::detail::implicit_cast<const X*>(pthis)), function_to_bind))
+				return;
+			base_type::bind(pthis, function_to_bind);
+		}
+
 		inline void bind(ReturnT(*function_to_bind)()) {
 			assert(NULL != function_to_bind);
 			m_pthis = NULL; m_free_func = NULL;
 			base_type::bind(function_to_bind);
 		}
 
+		template < class Y, ReturnT(*function_to_bind)(Y*) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk<Y, function_to_bind>);
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk_const<Y, function_to_bind>);
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*) >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk_const<Y, function_to_bind>);
+		}
+
+#if DELEGATES_CPLUSPLUS >= 201103L
+		template < class LambdaT >
+		inline typename std::enable_if<detail::is_function_convertible<LambdaT, ReturnT(*)()>::value>::type
+			bind(const LambdaT &lambda) {
+			bind(static_cast<ReturnT(*)()>(lambda));
+		}
+
+		template < class FunctorT >
+		inline typename std::enable_if<detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)() const>::value>::type
+			bind(const FunctorT *functor) {
+			bind(functor, static_cast<ReturnT(FunctorT::*)() const>(&FunctorT::operator()));
+		}
+
+		template < class FunctorT >
+		inline typename std::enable_if<!detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)() const>::value &&
+			detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)()>::value>::type
+			bind(FunctorT *functor) {
+			bind(functor, static_cast<ReturnT(FunctorT::*)()>(&FunctorT::operator()));
+		}
+#endif
+
 	private:
 
 		void *m_pthis;
 		free_function_like_member_t m_free_func;
 
+		// proxy is bound to the delegate itself so only this case can't be copied bitwise:
+		// the copied memento calls the same proxy, only 'this' is patched
+		void rebind_proxy() DELEGATES_NOEXCEPT
+		{
+			detail::DelegateMementoHack::set_pthis(
+				const_cast<fastdelegate::DelegateMemento&>(detail::DelegateMementoHack::get_memento(*this)), this);
+		}
+
 		template< class Y >
 		ReturnT f_proxy() const 
 		{ 
@@ -301,6 +709,18 @@ namespace delegates
 
 			return reinterpret_cast<type_free_function_like_member_t>(m_free_func)(static_cast<const Y*>(m_pthis));
 		}
+
+		template< class Y, ReturnT(*function_to_bind)(Y*) >
+		ReturnT f_thunk() const
+		{
+			return function_to_bind(reinterpret_cast<Y*>(const_cast<delegate*>(this)));
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(const Y*) >
+		ReturnT f_thunk_const() const
+		{
+			return function_to_bind(reinterpret_cast<const Y*>(this));
+		}
 	};
 
 	template<class ReturnT, class Param1T>
@@ -362,26 +782,32 @@ namespace delegates
 		template < class Y >
 		delegate(Y *pthis,
 			ReturnT(*function_to_bind)(Y*, Param1T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 		template < class Y >
 		delegate(Y *pthis,
 			ReturnT(*function_to_bind)(const Y*, Param1T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 		template < class Y >
 		delegate(const Y *pthis,
 			ReturnT(*function_to_bind)(const Y*, Param1T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 
 		delegate(ReturnT(*function_to_bind)(Param1T))
@@ -392,35 +818,72 @@ namespace delegates
 			assert(NULL != function_to_bind);
 		}
 
-		delegate(const delegate &other)
+		delegate(const delegate &other) DELEGATES_NOEXCEPT
+			: base_type(other),
+			m_pthis(other.m_pthis),
+			m_free_func(other.m_free_func)
 		{
-			{
-				f_proxy_type proxy = &delegate::f_proxy<delegate>;
-				base_type::bind(this, proxy);
-				fastdelegate::DelegateMemento tmp = (base_type(other)).GetMemento();
-				if(other.m_free_func)
-					detail::DelegateMementoHack::copy_pthis(tmp, base_type::GetMemento());
-				base_type::SetMemento(tmp);
-			}
-			using namespace std;
-			memcpy(&m_pthis, &other.m_pthis, sizeof(m_pthis));
-			memcpy(&m_free_func, &other.m_free_func, sizeof(m_free_func));
+			if(m_free_func)
+				rebind_proxy();
 		}
 
-		void operator=(const delegate &other)
+		void operator=(const delegate &other) DELEGATES_NOEXCEPT
 		{
-			{
-				f_proxy_type proxy = &delegate::f_proxy<delegate>;
-				base_type::bind(this, proxy);
-				fastdelegate::DelegateMemento tmp = (base_type(other)).GetMemento();
-				if(other.m_free_func)
-					detail::DelegateMementoHack::copy_pthis(tmp, base_type::GetMemento());
-				base_type::SetMemento(tmp);
-			}
-			using namespace std;
-			memcpy(&m_pthis, &other.m_pthis, sizeof(m_pthis));
-			memcpy(&m_free_func, &other.m_free_func, sizeof(m_free_func));
+			base_type::operator=(other);
+			m_pthis = other.m_pthis;
+			m_free_func = other.m_free_func;
+			if(m_free_func)
+				rebind_proxy();
+		}
+
+#if DELEGATES_CPLUSPLUS >= 201103L
+		delegate(delegate &&other) DELEGATES_NOEXCEPT
+			: base_type(other),
+			m_pthis(other.m_pthis),
+			m_free_func(other.m_free_func)
+		{
+			if(m_free_func)
+				rebind_proxy();
+		}
+
+		void operator=(delegate &&other) DELEGATES_NOEXCEPT
+		{
+			operator=(static_cast<const delegate&>(other));
+		}
+
+		// captureless lambda is bound as static function
+		template < class LambdaT >
+		delegate(const LambdaT &lambda,
+			typename std::enable_if<detail::is_function_convertible<LambdaT, ReturnT(*)(Param1T)>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(lambda);
+		}
+
+		// functor (lambda with captures) is bound by pointer as its 'operator()', so it should outlive the delegate
+		template < class FunctorT >
+		delegate(const FunctorT *functor,
+			typename std::enable_if<detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T) const>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(functor);
+		}
+
+		template < class FunctorT >
+		delegate(FunctorT *functor,
+			typename std::enable_if<!detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T) const>::value &&
+				detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T)>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(functor);
 		}
+#endif
 		
 		bool operator==(const delegate &other) const 
 		{
@@ -428,7 +891,7 @@ namespace delegates
 				return ( static_cast<const base_type&>(*this) == static_cast<const base_type&>(other) );
 			
 			if(m_pthis == other.m_pthis && m_free_func == other.m_free_func)
-				return detail::DelegateMementoHack::is_equal_pFunction((base_type(*this)).GetMemento(), (base_type(other)).GetMemento());
+				return detail::DelegateMementoHack::is_equal_pFunction(detail::DelegateMementoHack::get_memento(*this), detail::DelegateMementoHack::get_memento(other));
 			else
 				return false;
 		}
@@ -440,48 +903,74 @@ namespace delegates
 
 		bool operator<(const delegate &other) const 
 		{
+			const delegate_sort_key key = sort_key(), other_key = other.sort_key();
+			if(key != other_key)
+				return key < other_key;
 			if(!m_free_func && !other.m_free_func)
 				return ( static_cast<const base_type&>(*this) < static_cast<const base_type&>(other) );
 			if(m_pthis != other.m_pthis)
 				return m_pthis < other.m_pthis;
 			if(m_free_func != other.m_free_func)
 				return m_free_func < other.m_free_func;
-			return detail::DelegateMementoHack::is_less_pFunction((base_type(*this)).GetMemento(), (base_type(other)).GetMemento());
+			return detail::DelegateMementoHack::is_less_pFunction(detail::DelegateMementoHack::get_memento(*this), detail::DelegateMementoHack::get_memento(other));
 		}
 
 		bool operator>(const delegate &other) const 
 		{
-			if(!m_free_func && !other.m_free_func)
-				return ( static_cast<const base_type&>(*this) > static_cast<const base_type&>(other) );
-			if(m_pthis != other.m_pthis)
-				return m_pthis > other.m_pthis;
-			if(m_free_func != other.m_free_func)
-				return m_free_func > other.m_free_func;
-			return detail::DelegateMementoHack::is_less_pFunction((base_type(other)).GetMemento(), (base_type(*this)).GetMemento());
+			return other < *this;
+		}
+
+		std::size_t hash() const
+		{
+			const fastdelegate::DelegateMemento &memento = detail::DelegateMementoHack::get_memento(*this);
+			if(!m_free_func)
+				return detail::DelegateMementoHack::hash(memento);
+			std::size_t seed = detail::DelegateMementoHack::hash_pFunction(memento);
+			seed = detail::DelegateMementoHack::hash_combine(seed, reinterpret_cast<std::size_t>(m_pthis));
+			return detail::DelegateMementoHack::hash_combine(seed, reinterpret_cast<std::size_t>(m_free_func));
+		}
+
+		delegate_sort_key sort_key() const
+		{
+			if(!m_free_func)
+				return detail::DelegateMementoHack::sort_key(detail::DelegateMementoHack::get_memento(*this));
+			delegate_sort_key key;
+			key.code = reinterpret_cast<std::size_t>(m_free_func);
+			key.object = reinterpret_cast<std::size_t>(m_pthis);
+			return key;
 		}
 
 		template < class Y >
 		inline void bind(Y *pthis, ReturnT(*function_to_bind)(Y*, Param1T)) {
 			this->clear();
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
 			m_pthis = static_cast<void*>(pthis);
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class Y >
 		inline void bind(Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T)) {
 			this->clear();
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
 			m_pthis = static_cast<void*>(pthis);
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class Y >
 		inline void bind(const Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T)) {
 			this->clear();
-			m_pthis = static_cast<void*>(pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class X, class Y >
@@ -500,16 +989,88 @@ namespace delegates
 			base_type::bind(pthis, function_to_bind);
 		}
 
+		// virtual function is resolved for 'pthis' once here instead of on every call,
+		// so 'pthis' must not change its dynamic type while bound (same as 'bind' if not supported by compiler)
+		template < class X, class Y >
+		inline void bind_devirtualized(Y *pthis, ReturnT(X::* function_to_bind)(Param1T)) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::bind_devirtualized(*this, fastdelegate::detail::implicit_cast<X*>(pthis), function_to_bind))
+				return;
+			base_type::bind(pthis, function_to_bind);
+		}
+
+		template < class X, class Y >
+		inline void bind_devirtualized(const Y *pthis, ReturnT(X::* function_to_bind)(Param1T) const) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::bind_devirtualized(*this, const_cast<X*>(fastdelegate::detail::implicit_cast<const X*>(pthis)), function_to_bind))
+				return;
+			base_type::bind(pthis, function_to_bind);
+		}
+
 		inline void bind(ReturnT(*function_to_bind)(Param1T)) {
 			assert(NULL != function_to_bind);
 			m_pthis = NULL; m_free_func = NULL;
 			base_type::bind(function_to_bind);
 		}
 
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk<Y, function_to_bind>);
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk_const<Y, function_to_bind>);
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T) >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk_const<Y, function_to_bind>);
+		}
+
+#if DELEGATES_CPLUSPLUS >= 201103L
+		template < class LambdaT >
+		inline typename std::enable_if<detail::is_function_convertible<LambdaT, ReturnT(*)(Param1T)>::value>::type
+			bind(const LambdaT &lambda) {
+			bind(static_cast<ReturnT(*)(Param1T)>(lambda));
+		}
+
+		template < class FunctorT >
+		inline typename std::enable_if<detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T) const>::value>::type
+			bind(const FunctorT *functor) {
+			bind(functor, static_cast<ReturnT(FunctorT::*)(Param1T) const>(&FunctorT::operator()));
+		}
+
+		template < class FunctorT >
+		inline typename std::enable_if<!detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T) const>::value &&
+			detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T)>::value>::type
+			bind(FunctorT *functor) {
+			bind(functor, static_cast<ReturnT(FunctorT::*)(Param1T)>(&FunctorT::operator()));
+		}
+#endif
+
 	private:
 		void *m_pthis;
 		free_function_like_member_t m_free_func;
 
+		// proxy is bound to the delegate itself so only this case can't be copied bitwise:
+		// the copied memento calls the same proxy, only 'this' is patched
+		void rebind_proxy() DELEGATES_NOEXCEPT
+		{
+			detail::DelegateMementoHack::set_pthis(
+				const_cast<fastdelegate::DelegateMemento&>(detail::DelegateMementoHack::get_memento(*this)), this);
+		}
+
 		template< class Y >
 		ReturnT f_proxy(Param1T p1) const
 		{
@@ -525,6 +1086,18 @@ namespace delegates
 
 			return reinterpret_cast<type_free_function_like_member_t>(m_free_func)(static_cast<const Y*>(m_pthis), p1);
 		}
+
+		template< class Y, ReturnT(*function_to_bind)(Y*, Param1T) >
+		ReturnT f_thunk(Param1T p1) const
+		{
+			return function_to_bind(reinterpret_cast<Y*>(const_cast<delegate*>(this)), p1);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(const Y*, Param1T) >
+		ReturnT f_thunk_const(Param1T p1) const
+		{
+			return function_to_bind(reinterpret_cast<const Y*>(this), p1);
+		}
 	};
 
 	template<class ReturnT, class Param1T, class Param2T>
@@ -587,26 +1160,32 @@ namespace delegates
 		template < class Y >
 		delegate(Y *pthis,
 			ReturnT(*function_to_bind)(Y*, Param1T, Param2T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
-
-		template < class Y >
-		delegate(Y *pthis,
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
+
+		template < class Y >
+		delegate(Y *pthis,
 			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 		template < class Y >
 		delegate(const Y *pthis,
 			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 
 		delegate(ReturnT(*function_to_bind)(Param1T, Param2T))
@@ -617,35 +1196,72 @@ namespace delegates
 			assert(NULL != function_to_bind);
 		}
 
-		delegate(const delegate &other)
+		delegate(const delegate &other) DELEGATES_NOEXCEPT
+			: base_type(other),
+			m_pthis(other.m_pthis),
+			m_free_func(other.m_free_func)
 		{
-			{
-				f_proxy_type proxy = &delegate::f_proxy<delegate>;
-				base_type::bind(this, proxy);
-				fastdelegate::DelegateMemento tmp = (base_type(other)).GetMemento();
-				if(other.m_free_func)
-					detail::DelegateMementoHack::copy_pthis(tmp, base_type::GetMemento());
-				base_type::SetMemento(tmp);
-			}
-			using namespace std;
-			memcpy(&m_pthis, &other.m_pthis, sizeof(m_pthis));
-			memcpy(&m_free_func, &other.m_free_func, sizeof(m_free_func));
+			if(m_free_func)
+				rebind_proxy();
 		}
 
-		void operator=(const delegate &other)
+		void operator=(const delegate &other) DELEGATES_NOEXCEPT
 		{
-			{
-				f_proxy_type proxy = &delegate::f_proxy<delegate>;
-				base_type::bind(this, proxy);
-				fastdelegate::DelegateMemento tmp = (base_type(other)).GetMemento();
-				if(other.m_free_func)
-					detail::DelegateMementoHack::copy_pthis(tmp, base_type::GetMemento());
-				base_type::SetMemento(tmp);
-			}
-			using namespace std;
-			memcpy(&m_pthis, &other.m_pthis, sizeof(m_pthis));
-			memcpy(&m_free_func, &other.m_free_func, sizeof(m_free_func));
+			base_type::operator=(other);
+			m_pthis = other.m_pthis;
+			m_free_func = other.m_free_func;
+			if(m_free_func)
+				rebind_proxy();
+		}
+
+#if DELEGATES_CPLUSPLUS >= 201103L
+		delegate(delegate &&other) DELEGATES_NOEXCEPT
+			: base_type(other),
+			m_pthis(other.m_pthis),
+			m_free_func(other.m_free_func)
+		{
+			if(m_free_func)
+				rebind_proxy();
+		}
+
+		void operator=(delegate &&other) DELEGATES_NOEXCEPT
+		{
+			operator=(static_cast<const delegate&>(other));
+		}
+
+		// captureless lambda is bound as static function
+		template < class LambdaT >
+		delegate(const LambdaT &lambda,
+			typename std::enable_if<detail::is_function_convertible<LambdaT, ReturnT(*)(Param1T, Param2T)>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(lambda);
+		}
+
+		// functor (lambda with captures) is bound by pointer as its 'operator()', so it should outlive the delegate
+		template < class FunctorT >
+		delegate(const FunctorT *functor,
+			typename std::enable_if<detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T) const>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(functor);
+		}
+
+		template < class FunctorT >
+		delegate(FunctorT *functor,
+			typename std::enable_if<!detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T) const>::value &&
+				detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T)>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(functor);
 		}
+#endif
 		
 		bool operator==(const delegate &other) const 
 		{
@@ -653,7 +1269,7 @@ namespace delegates
 				return ( static_cast<const base_type&>(*this) == static_cast<const base_type&>(other) );
 			
 			if(m_pthis == other.m_pthis && m_free_func == other.m_free_func)
-				return detail::DelegateMementoHack::is_equal_pFunction((base_type(*this)).GetMemento(), (base_type(other)).GetMemento());
+				return detail::DelegateMementoHack::is_equal_pFunction(detail::DelegateMementoHack::get_memento(*this), detail::DelegateMementoHack::get_memento(other));
 			else
 				return false;
 		}
@@ -665,48 +1281,74 @@ namespace delegates
 
 		bool operator<(const delegate &other) const 
 		{
+			const delegate_sort_key key = sort_key(), other_key = other.sort_key();
+			if(key != other_key)
+				return key < other_key;
 			if(!m_free_func && !other.m_free_func)
 				return ( static_cast<const base_type&>(*this) < static_cast<const base_type&>(other) );
 			if(m_pthis != other.m_pthis)
 				return m_pthis < other.m_pthis;
 			if(m_free_func != other.m_free_func)
 				return m_free_func < other.m_free_func;
-			return detail::DelegateMementoHack::is_less_pFunction((base_type(*this)).GetMemento(), (base_type(other)).GetMemento());
+			return detail::DelegateMementoHack::is_less_pFunction(detail::DelegateMementoHack::get_memento(*this), detail::DelegateMementoHack::get_memento(other));
 		}
 
 		bool operator>(const delegate &other) const 
 		{
-			if(!m_free_func && !other.m_free_func)
-				return ( static_cast<const base_type&>(*this) > static_cast<const base_type&>(other) );
-			if(m_pthis != other.m_pthis)
-				return m_pthis > other.m_pthis;
-			if(m_free_func != other.m_free_func)
-				return m_free_func > other.m_free_func;
-			return detail::DelegateMementoHack::is_less_pFunction((base_type(other)).GetMemento(), (base_type(*this)).GetMemento());
+			return other < *this;
+		}
+
+		std::size_t hash() const
+		{
+			const fastdelegate::DelegateMemento &memento = detail::DelegateMementoHack::get_memento(*this);
+			if(!m_free_func)
+				return detail::DelegateMementoHack::hash(memento);
+			std::size_t seed = detail::DelegateMementoHack::hash_pFunction(memento);
+			seed = detail::DelegateMementoHack::hash_combine(seed, reinterpret_cast<std::size_t>(m_pthis));
+			return detail::DelegateMementoHack::hash_combine(seed, reinterpret_cast<std::size_t>(m_free_func));
+		}
+
+		delegate_sort_key sort_key() const
+		{
+			if(!m_free_func)
+				return detail::DelegateMementoHack::sort_key(detail::DelegateMementoHack::get_memento(*this));
+			delegate_sort_key key;
+			key.code = reinterpret_cast<std::size_t>(m_free_func);
+			key.object = reinterpret_cast<std::size_t>(m_pthis);
+			return key;
 		}
 
 		template < class Y >
 		inline void bind(Y *pthis, ReturnT(*function_to_bind)(Y*, Param1T, Param2T)) {
 			this->clear();
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
 			m_pthis = static_cast<void*>(pthis);
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class Y >
 		inline void bind(Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T)) {
 			this->clear();
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
 			m_pthis = static_cast<void*>(pthis);
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class Y >
 		inline void bind(const Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T)) {
 			this->clear();
-			m_pthis = static_cast<void*>(pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class X, class Y >
@@ -725,16 +1367,88 @@ namespace delegates
 			base_type::bind(pthis, function_to_bind);
 		}
 
+		// virtual function is resolved for 'pthis' once here instead of on every call,
+		// so 'pthis' must not change its dynamic type while bound (same as 'bind' if not supported by compiler)
+		template < class X, class Y >
+		inline void bind_devirtualized(Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T)) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::bind_devirtualized(*this, fastdelegate::detail::implicit_cast<X*>(pthis), function_to_bind))
+				return;
+			base_type::bind(pthis, function_to_bind);
+		}
+
+		template < class X, class Y >
+		inline void bind_devirtualized(const Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T) const) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::bind_devirtualized(*this, const_cast<X*>(fastdelegate::detail::implicit_cast<const X*>(pthis)), function_to_bind))
+				return;
+			base_type::bind(pthis, function_to_bind);
+		}
+
 		inline void bind(ReturnT(*function_to_bind)(Param1T, Param2T)) {
 			assert(NULL != function_to_bind);
 			m_pthis = NULL; m_free_func = NULL;
 			base_type::bind(function_to_bind);
 		}
 
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk<Y, function_to_bind>);
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk_const<Y, function_to_bind>);
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T) >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk_const<Y, function_to_bind>);
+		}
+
+#if DELEGATES_CPLUSPLUS >= 201103L
+		template < class LambdaT >
+		inline typename std::enable_if<detail::is_function_convertible<LambdaT, ReturnT(*)(Param1T, Param2T)>::value>::type
+			bind(const LambdaT &lambda) {
+			bind(static_cast<ReturnT(*)(Param1T, Param2T)>(lambda));
+		}
+
+		template < class FunctorT >
+		inline typename std::enable_if<detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T) const>::value>::type
+			bind(const FunctorT *functor) {
+			bind(functor, static_cast<ReturnT(FunctorT::*)(Param1T, Param2T) const>(&FunctorT::operator()));
+		}
+
+		template < class FunctorT >
+		inline typename std::enable_if<!detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T) const>::value &&
+			detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T)>::value>::type
+			bind(FunctorT *functor) {
+			bind(functor, static_cast<ReturnT(FunctorT::*)(Param1T, Param2T)>(&FunctorT::operator()));
+		}
+#endif
+
 	private:
 		void *m_pthis;
 		free_function_like_member_t m_free_func;
 
+		// proxy is bound to the delegate itself so only this case can't be copied bitwise:
+		// the copied memento calls the same proxy, only 'this' is patched
+		void rebind_proxy() DELEGATES_NOEXCEPT
+		{
+			detail::DelegateMementoHack::set_pthis(
+				const_cast<fastdelegate::DelegateMemento&>(detail::DelegateMementoHack::get_memento(*this)), this);
+		}
+
 		template< class Y >
 		ReturnT f_proxy(Param1T p1, Param2T p2) const
 		{
@@ -750,6 +1464,18 @@ namespace delegates
 
 			return reinterpret_cast<type_free_function_like_member_t>(m_free_func)(static_cast<const Y*>(m_pthis), p1, p2);
 		}
+
+		template< class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T) >
+		ReturnT f_thunk(Param1T p1, Param2T p2) const
+		{
+			return function_to_bind(reinterpret_cast<Y*>(const_cast<delegate*>(this)), p1, p2);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T) >
+		ReturnT f_thunk_const(Param1T p1, Param2T p2) const
+		{
+			return function_to_bind(reinterpret_cast<const Y*>(this), p1, p2);
+		}
 	};
 
 	template<class ReturnT, class Param1T, class Param2T, class Param3T>
@@ -811,26 +1537,32 @@ namespace delegates
 		template < class Y >
 		delegate(Y *pthis,
 			ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 		template < class Y >
 		delegate(Y *pthis,
 			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 		template < class Y >
 		delegate(const Y *pthis,
 			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 
 		delegate(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T))
@@ -841,35 +1573,72 @@ namespace delegates
 			assert(NULL != function_to_bind);
 		}
 
-		delegate(const delegate &other)
+		delegate(const delegate &other) DELEGATES_NOEXCEPT
+			: base_type(other),
+			m_pthis(other.m_pthis),
+			m_free_func(other.m_free_func)
 		{
-			{
-				f_proxy_type proxy = &delegate::f_proxy<delegate>;
-				base_type::bind(this, proxy);
-				fastdelegate::DelegateMemento tmp = (base_type(other)).GetMemento();
-				if(other.m_free_func)
-					detail::DelegateMementoHack::copy_pthis(tmp, base_type::GetMemento());
-				base_type::SetMemento(tmp);
-			}
-			using namespace std;
-			memcpy(&m_pthis, &other.m_pthis, sizeof(m_pthis));
-			memcpy(&m_free_func, &other.m_free_func, sizeof(m_free_func));
+			if(m_free_func)
+				rebind_proxy();
 		}
 
-		void operator=(const delegate &other)
+		void operator=(const delegate &other) DELEGATES_NOEXCEPT
 		{
-			{
-				f_proxy_type proxy = &delegate::f_proxy<delegate>;
-				base_type::bind(this, proxy);
-				fastdelegate::DelegateMemento tmp = (base_type(other)).GetMemento();
-				if(other.m_free_func)
-					detail::DelegateMementoHack::copy_pthis(tmp, base_type::GetMemento());
-				base_type::SetMemento(tmp);
-			}
-			using namespace std;
-			memcpy(&m_pthis, &other.m_pthis, sizeof(m_pthis));
-			memcpy(&m_free_func, &other.m_free_func, sizeof(m_free_func));
+			base_type::operator=(other);
+			m_pthis = other.m_pthis;
+			m_free_func = other.m_free_func;
+			if(m_free_func)
+				rebind_proxy();
+		}
+
+#if DELEGATES_CPLUSPLUS >= 201103L
+		delegate(delegate &&other) DELEGATES_NOEXCEPT
+			: base_type(other),
+			m_pthis(other.m_pthis),
+			m_free_func(other.m_free_func)
+		{
+			if(m_free_func)
+				rebind_proxy();
+		}
+
+		void operator=(delegate &&other) DELEGATES_NOEXCEPT
+		{
+			operator=(static_cast<const delegate&>(other));
+		}
+
+		// captureless lambda is bound as static function
+		template < class LambdaT >
+		delegate(const LambdaT &lambda,
+			typename std::enable_if<detail::is_function_convertible<LambdaT, ReturnT(*)(Param1T, Param2T, Param3T)>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(lambda);
+		}
+
+		// functor (lambda with captures) is bound by pointer as its 'operator()', so it should outlive the delegate
+		template < class FunctorT >
+		delegate(const FunctorT *functor,
+			typename std::enable_if<detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T) const>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(functor);
+		}
+
+		template < class FunctorT >
+		delegate(FunctorT *functor,
+			typename std::enable_if<!detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T) const>::value &&
+				detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T)>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(functor);
 		}
+#endif
 		
 		bool operator==(const delegate &other) const 
 		{
@@ -877,7 +1646,7 @@ namespace delegates
 				return ( static_cast<const base_type&>(*this) == static_cast<const base_type&>(other) );
 			
 			if(m_pthis == other.m_pthis && m_free_func == other.m_free_func)
-				return detail::DelegateMementoHack::is_equal_pFunction((base_type(*this)).GetMemento(), (base_type(other)).GetMemento());
+				return detail::DelegateMementoHack::is_equal_pFunction(detail::DelegateMementoHack::get_memento(*this), detail::DelegateMementoHack::get_memento(other));
 			else
 				return false;
 		}
@@ -889,48 +1658,74 @@ namespace delegates
 
 		bool operator<(const delegate &other) const 
 		{
+			const delegate_sort_key key = sort_key(), other_key = other.sort_key();
+			if(key != other_key)
+				return key < other_key;
 			if(!m_free_func && !other.m_free_func)
 				return ( static_cast<const base_type&>(*this) < static_cast<const base_type&>(other) );
 			if(m_pthis != other.m_pthis)
 				return m_pthis < other.m_pthis;
 			if(m_free_func != other.m_free_func)
 				return m_free_func < other.m_free_func;
-			return detail::DelegateMementoHack::is_less_pFunction((base_type(*this)).GetMemento(), (base_type(other)).GetMemento());
+			return detail::DelegateMementoHack::is_less_pFunction(detail::DelegateMementoHack::get_memento(*this), detail::DelegateMementoHack::get_memento(other));
 		}
 
 		bool operator>(const delegate &other) const 
 		{
-			if(!m_free_func && !other.m_free_func)
-				return ( static_cast<const base_type&>(*this) > static_cast<const base_type&>(other) );
-			if(m_pthis != other.m_pthis)
-				return m_pthis > other.m_pthis;
-			if(m_free_func != other.m_free_func)
-				return m_free_func > other.m_free_func;
-			return detail::DelegateMementoHack::is_less_pFunction((base_type(other)).GetMemento(), (base_type(*this)).GetMemento());
+			return other < *this;
+		}
+
+		std::size_t hash() const
+		{
+			const fastdelegate::DelegateMemento &memento = detail::DelegateMementoHack::get_memento(*this);
+			if(!m_free_func)
+				return detail::DelegateMementoHack::hash(memento);
+			std::size_t seed = detail::DelegateMementoHack::hash_pFunction(memento);
+			seed = detail::DelegateMementoHack::hash_combine(seed, reinterpret_cast<std::size_t>(m_pthis));
+			return detail::DelegateMementoHack::hash_combine(seed, reinterpret_cast<std::size_t>(m_free_func));
+		}
+
+		delegate_sort_key sort_key() const
+		{
+			if(!m_free_func)
+				return detail::DelegateMementoHack::sort_key(detail::DelegateMementoHack::get_memento(*this));
+			delegate_sort_key key;
+			key.code = reinterpret_cast<std::size_t>(m_free_func);
+			key.object = reinterpret_cast<std::size_t>(m_pthis);
+			return key;
 		}
 
 		template < class Y >
 		inline void bind(Y *pthis, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T)) {
 			this->clear();
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
 			m_pthis = static_cast<void*>(pthis);
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class Y >
 		inline void bind(Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T)) {
 			this->clear();
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
 			m_pthis = static_cast<void*>(pthis);
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class Y >
 		inline void bind(const Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T)) {
 			this->clear();
-			m_pthis = static_cast<void*>(pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class X, class Y >
@@ -949,16 +1744,88 @@ namespace delegates
 			base_type::bind(pthis, function_to_bind);
 		}
 
+		// virtual function is resolved for 'pthis' once here instead of on every call,
+		// so 'pthis' must not change its dynamic type while bound (same as 'bind' if not supported by compiler)
+		template < class X, class Y >
+		inline void bind_devirtualized(Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T)) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::bind_devirtualized(*this, fastdelegate::detail::implicit_cast<X*>(pthis), function_to_bind))
+				return;
+			base_type::bind(pthis, function_to_bind);
+		}
+
+		template < class X, class Y >
+		inline void bind_devirtualized(const Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T) const) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::bind_devirtualized(*this, const_cast<X*>(fastdelegate::detail::implicit_cast<const X*>(pthis)), function_to_bind))
+				return;
+			base_type::bind(pthis, function_to_bind);
+		}
+
 		inline void bind(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T)) {
 			assert(NULL != function_to_bind);
 			m_pthis = NULL; m_free_func = NULL;
 			base_type::bind(function_to_bind);
 		}
 
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk<Y, function_to_bind>);
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk_const<Y, function_to_bind>);
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T) >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk_const<Y, function_to_bind>);
+		}
+
+#if DELEGATES_CPLUSPLUS >= 201103L
+		template < class LambdaT >
+		inline typename std::enable_if<detail::is_function_convertible<LambdaT, ReturnT(*)(Param1T, Param2T, Param3T)>::value>::type
+			bind(const LambdaT &lambda) {
+			bind(static_cast<ReturnT(*)(Param1T, Param2T, Param3T)>(lambda));
+		}
+
+		template < class FunctorT >
+		inline typename std::enable_if<detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T) const>::value>::type
+			bind(const FunctorT *functor) {
+			bind(functor, static_cast<ReturnT(FunctorT::*)(Param1T, Param2T, Param3T) const>(&FunctorT::operator()));
+		}
+
+		template < class FunctorT >
+		inline typename std::enable_if<!detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T) const>::value &&
+			detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T)>::value>::type
+			bind(FunctorT *functor) {
+			bind(functor, static_cast<ReturnT(FunctorT::*)(Param1T, Param2T, Param3T)>(&FunctorT::operator()));
+		}
+#endif
+
 	private:
 		void *m_pthis;
 		free_function_like_member_t m_free_func;
 
+		// proxy is bound to the delegate itself so only this case can't be copied bitwise:
+		// the copied memento calls the same proxy, only 'this' is patched
+		void rebind_proxy() DELEGATES_NOEXCEPT
+		{
+			detail::DelegateMementoHack::set_pthis(
+				const_cast<fastdelegate::DelegateMemento&>(detail::DelegateMementoHack::get_memento(*this)), this);
+		}
+
 		template< class Y >
 		ReturnT f_proxy(Param1T p1, Param2T p2, Param3T p3) const
 		{
@@ -974,6 +1841,18 @@ namespace delegates
 
 			return reinterpret_cast<type_free_function_like_member_t>(m_free_func)(static_cast<const Y*>(m_pthis), p1, p2, p3);
 		}
+
+		template< class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T) >
+		ReturnT f_thunk(Param1T p1, Param2T p2, Param3T p3) const
+		{
+			return function_to_bind(reinterpret_cast<Y*>(const_cast<delegate*>(this)), p1, p2, p3);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T) >
+		ReturnT f_thunk_const(Param1T p1, Param2T p2, Param3T p3) const
+		{
+			return function_to_bind(reinterpret_cast<const Y*>(this), p1, p2, p3);
+		}
 	};
 
 	template<class ReturnT, class Param1T, class Param2T, class Param3T, class Param4T>
@@ -1035,26 +1914,32 @@ namespace delegates
 		template < class Y >
 		delegate(Y *pthis,
 			ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 		template < class Y >
 		delegate(Y *pthis,
 			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 		template < class Y >
 		delegate(const Y *pthis,
 			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 
 		delegate(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T))
@@ -1065,35 +1950,72 @@ namespace delegates
 			assert(NULL != function_to_bind);
 		}
 
-		delegate(const delegate &other)
+		delegate(const delegate &other) DELEGATES_NOEXCEPT
+			: base_type(other),
+			m_pthis(other.m_pthis),
+			m_free_func(other.m_free_func)
 		{
-			{
-				f_proxy_type proxy = &delegate::f_proxy<delegate>;
-				base_type::bind(this, proxy);
-				fastdelegate::DelegateMemento tmp = (base_type(other)).GetMemento();
-				if(other.m_free_func)
-					detail::DelegateMementoHack::copy_pthis(tmp, base_type::GetMemento());
-				base_type::SetMemento(tmp);
-			}
-			using namespace std;
-			memcpy(&m_pthis, &other.m_pthis, sizeof(m_pthis));
-			memcpy(&m_free_func, &other.m_free_func, sizeof(m_free_func));
+			if(m_free_func)
+				rebind_proxy();
 		}
 
-		void operator=(const delegate &other)
+		void operator=(const delegate &other) DELEGATES_NOEXCEPT
 		{
-			{
-				f_proxy_type proxy = &delegate::f_proxy<delegate>;
-				base_type::bind(this, proxy);
-				fastdelegate::DelegateMemento tmp = (base_type(other)).GetMemento();
-				if(other.m_free_func)
-					detail::DelegateMementoHack::copy_pthis(tmp, base_type::GetMemento());
-				base_type::SetMemento(tmp);
-			}
-			using namespace std;
-			memcpy(&m_pthis, &other.m_pthis, sizeof(m_pthis));
-			memcpy(&m_free_func, &other.m_free_func, sizeof(m_free_func));
+			base_type::operator=(other);
+			m_pthis = other.m_pthis;
+			m_free_func = other.m_free_func;
+			if(m_free_func)
+				rebind_proxy();
+		}
+
+#if DELEGATES_CPLUSPLUS >= 201103L
+		delegate(delegate &&other) DELEGATES_NOEXCEPT
+			: base_type(other),
+			m_pthis(other.m_pthis),
+			m_free_func(other.m_free_func)
+		{
+			if(m_free_func)
+				rebind_proxy();
+		}
+
+		void operator=(delegate &&other) DELEGATES_NOEXCEPT
+		{
+			operator=(static_cast<const delegate&>(other));
+		}
+
+		// captureless lambda is bound as static function
+		template < class LambdaT >
+		delegate(const LambdaT &lambda,
+			typename std::enable_if<detail::is_function_convertible<LambdaT, ReturnT(*)(Param1T, Param2T, Param3T, Param4T)>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(lambda);
+		}
+
+		// functor (lambda with captures) is bound by pointer as its 'operator()', so it should outlive the delegate
+		template < class FunctorT >
+		delegate(const FunctorT *functor,
+			typename std::enable_if<detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T) const>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(functor);
+		}
+
+		template < class FunctorT >
+		delegate(FunctorT *functor,
+			typename std::enable_if<!detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T) const>::value &&
+				detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T)>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(functor);
 		}
+#endif
 		
 		bool operator==(const delegate &other) const 
 		{
@@ -1101,7 +2023,7 @@ namespace delegates
 				return ( static_cast<const base_type&>(*this) == static_cast<const base_type&>(other) );
 			
 			if(m_pthis == other.m_pthis && m_free_func == other.m_free_func)
-				return detail::DelegateMementoHack::is_equal_pFunction((base_type(*this)).GetMemento(), (base_type(other)).GetMemento());
+				return detail::DelegateMementoHack::is_equal_pFunction(detail::DelegateMementoHack::get_memento(*this), detail::DelegateMementoHack::get_memento(other));
 			else
 				return false;
 		}
@@ -1113,48 +2035,74 @@ namespace delegates
 
 		bool operator<(const delegate &other) const 
 		{
+			const delegate_sort_key key = sort_key(), other_key = other.sort_key();
+			if(key != other_key)
+				return key < other_key;
 			if(!m_free_func && !other.m_free_func)
 				return ( static_cast<const base_type&>(*this) < static_cast<const base_type&>(other) );
 			if(m_pthis != other.m_pthis)
 				return m_pthis < other.m_pthis;
 			if(m_free_func != other.m_free_func)
 				return m_free_func < other.m_free_func;
-			return detail::DelegateMementoHack::is_less_pFunction((base_type(*this)).GetMemento(), (base_type(other)).GetMemento());
+			return detail::DelegateMementoHack::is_less_pFunction(detail::DelegateMementoHack::get_memento(*this), detail::DelegateMementoHack::get_memento(other));
 		}
 
 		bool operator>(const delegate &other) const 
 		{
-			if(!m_free_func && !other.m_free_func)
-				return ( static_cast<const base_type&>(*this) > static_cast<const base_type&>(other) );
-			if(m_pthis != other.m_pthis)
-				return m_pthis > other.m_pthis;
-			if(m_free_func != other.m_free_func)
-				return m_free_func > other.m_free_func;
-			return detail::DelegateMementoHack::is_less_pFunction((base_type(other)).GetMemento(), (base_type(*this)).GetMemento());
+			return other < *this;
+		}
+
+		std::size_t hash() const
+		{
+			const fastdelegate::DelegateMemento &memento = detail::DelegateMementoHack::get_memento(*this);
+			if(!m_free_func)
+				return detail::DelegateMementoHack::hash(memento);
+			std::size_t seed = detail::DelegateMementoHack::hash_pFunction(memento);
+			seed = detail::DelegateMementoHack::hash_combine(seed, reinterpret_cast<std::size_t>(m_pthis));
+			return detail::DelegateMementoHack::hash_combine(seed, reinterpret_cast<std::size_t>(m_free_func));
+		}
+
+		delegate_sort_key sort_key() const
+		{
+			if(!m_free_func)
+				return detail::DelegateMementoHack::sort_key(detail::DelegateMementoHack::get_memento(*this));
+			delegate_sort_key key;
+			key.code = reinterpret_cast<std::size_t>(m_free_func);
+			key.object = reinterpret_cast<std::size_t>(m_pthis);
+			return key;
 		}
 
 		template < class Y >
 		inline void bind(Y *pthis, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T)) {
 			this->clear();
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
 			m_pthis = static_cast<void*>(pthis);
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class Y >
 		inline void bind(Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T)) {
 			this->clear();
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
 			m_pthis = static_cast<void*>(pthis);
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class Y >
 		inline void bind(const Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T)) {
 			this->clear();
-			m_pthis = static_cast<void*>(pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class X, class Y >
@@ -1173,17 +2121,89 @@ namespace delegates
 			base_type::bind(pthis, function_to_bind);
 		}
 
+		// virtual function is resolved for 'pthis' once here instead of on every call,
+		// so 'pthis' must not change its dynamic type while bound (same as 'bind' if not supported by compiler)
+		template < class X, class Y >
+		inline void bind_devirtualized(Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T)) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::bind_devirtualized(*this, fastdelegate::detail::implicit_cast<X*>(pthis), function_to_bind))
+				return;
+			base_type::bind(pthis, function_to_bind);
+		}
+
+		template < class X, class Y >
+		inline void bind_devirtualized(const Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T) const) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::bind_devirtualized(*this, const_cast<X*>(fastdelegate::detail::implicit_cast<const X*>(pthis)), function_to_bind))
+				return;
+			base_type::bind(pthis, function_to_bind);
+		}
+
 		inline void bind(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T)) {
 			assert(NULL != function_to_bind);
 			m_pthis = NULL; m_free_func = NULL;
 			base_type::bind(function_to_bind);
 		}
 
-	private:
-		void *m_pthis;
-		free_function_like_member_t m_free_func;
-
-		template< class Y >
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk<Y, function_to_bind>);
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk_const<Y, function_to_bind>);
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T) >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk_const<Y, function_to_bind>);
+		}
+
+#if DELEGATES_CPLUSPLUS >= 201103L
+		template < class LambdaT >
+		inline typename std::enable_if<detail::is_function_convertible<LambdaT, ReturnT(*)(Param1T, Param2T, Param3T, Param4T)>::value>::type
+			bind(const LambdaT &lambda) {
+			bind(static_cast<ReturnT(*)(Param1T, Param2T, Param3T, Param4T)>(lambda));
+		}
+
+		template < class FunctorT >
+		inline typename std::enable_if<detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T) const>::value>::type
+			bind(const FunctorT *functor) {
+			bind(functor, static_cast<ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T) const>(&FunctorT::operator()));
+		}
+
+		template < class FunctorT >
+		inline typename std::enable_if<!detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T) const>::value &&
+			detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T)>::value>::type
+			bind(FunctorT *functor) {
+			bind(functor, static_cast<ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T)>(&FunctorT::operator()));
+		}
+#endif
+
+	private:
+		void *m_pthis;
+		free_function_like_member_t m_free_func;
+
+		// proxy is bound to the delegate itself so only this case can't be copied bitwise:
+		// the copied memento calls the same proxy, only 'this' is patched
+		void rebind_proxy() DELEGATES_NOEXCEPT
+		{
+			detail::DelegateMementoHack::set_pthis(
+				const_cast<fastdelegate::DelegateMemento&>(detail::DelegateMementoHack::get_memento(*this)), this);
+		}
+
+		template< class Y >
 		ReturnT f_proxy(Param1T p1, Param2T p2, Param3T p3, Param4T p4) const
 		{
 			typedef ReturnT(*type_free_function_like_member_t)(Y*, Param1T, Param2T, Param3T, Param4T);
@@ -1198,6 +2218,18 @@ namespace delegates
 
 			return reinterpret_cast<type_free_function_like_member_t>(m_free_func)(static_cast<const Y*>(m_pthis), p1, p2, p3, p4);
 		}
+
+		template< class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T) >
+		ReturnT f_thunk(Param1T p1, Param2T p2, Param3T p3, Param4T p4) const
+		{
+			return function_to_bind(reinterpret_cast<Y*>(const_cast<delegate*>(this)), p1, p2, p3, p4);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T) >
+		ReturnT f_thunk_const(Param1T p1, Param2T p2, Param3T p3, Param4T p4) const
+		{
+			return function_to_bind(reinterpret_cast<const Y*>(this), p1, p2, p3, p4);
+		}
 	};
 
 	template<class ReturnT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T>
@@ -1259,26 +2291,32 @@ namespace delegates
 		template < class Y >
 		delegate(Y *pthis,
 			ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 		template < class Y >
 		delegate(Y *pthis,
 			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 		template < class Y >
 		delegate(const Y *pthis,
 			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 
 		delegate(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T))
@@ -1289,35 +2327,72 @@ namespace delegates
 			assert(NULL != function_to_bind);
 		}
 
-		delegate(const delegate &other)
+		delegate(const delegate &other) DELEGATES_NOEXCEPT
+			: base_type(other),
+			m_pthis(other.m_pthis),
+			m_free_func(other.m_free_func)
 		{
-			{
-				f_proxy_type proxy = &delegate::f_proxy<delegate>;
-				base_type::bind(this, proxy);
-				fastdelegate::DelegateMemento tmp = (base_type(other)).GetMemento();
-				if(other.m_free_func || other.m_free_func_const)
-					detail::DelegateMementoHack::copy_pthis(tmp, base_type::GetMemento());
-				base_type::SetMemento(tmp);
-			}
-			using namespace std;
-			memcpy(&m_pthis, &other.m_pthis, sizeof(m_pthis));
-			memcpy(&m_free_func, &other.m_free_func, sizeof(m_free_func));
+			if(m_free_func)
+				rebind_proxy();
 		}
 
-		void operator=(const delegate &other)
+		void operator=(const delegate &other) DELEGATES_NOEXCEPT
 		{
-			{
-				f_proxy_type proxy = &delegate::f_proxy<delegate>;
-				base_type::bind(this, proxy);
-				fastdelegate::DelegateMemento tmp = (base_type(other)).GetMemento();
-				if(other.m_free_func || other.m_free_func_const)
-					detail::DelegateMementoHack::copy_pthis(tmp, base_type::GetMemento());
-				base_type::SetMemento(tmp);
-			}
-			using namespace std;
-			memcpy(&m_pthis, &other.m_pthis, sizeof(m_pthis));
-			memcpy(&m_free_func, &other.m_free_func, sizeof(m_free_func));
+			base_type::operator=(other);
+			m_pthis = other.m_pthis;
+			m_free_func = other.m_free_func;
+			if(m_free_func)
+				rebind_proxy();
+		}
+
+#if DELEGATES_CPLUSPLUS >= 201103L
+		delegate(delegate &&other) DELEGATES_NOEXCEPT
+			: base_type(other),
+			m_pthis(other.m_pthis),
+			m_free_func(other.m_free_func)
+		{
+			if(m_free_func)
+				rebind_proxy();
+		}
+
+		void operator=(delegate &&other) DELEGATES_NOEXCEPT
+		{
+			operator=(static_cast<const delegate&>(other));
+		}
+
+		// captureless lambda is bound as static function
+		template < class LambdaT >
+		delegate(const LambdaT &lambda,
+			typename std::enable_if<detail::is_function_convertible<LambdaT, ReturnT(*)(Param1T, Param2T, Param3T, Param4T, Param5T)>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(lambda);
+		}
+
+		// functor (lambda with captures) is bound by pointer as its 'operator()', so it should outlive the delegate
+		template < class FunctorT >
+		delegate(const FunctorT *functor,
+			typename std::enable_if<detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T) const>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(functor);
+		}
+
+		template < class FunctorT >
+		delegate(FunctorT *functor,
+			typename std::enable_if<!detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T) const>::value &&
+				detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T)>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(functor);
 		}
+#endif
 		
 		bool operator==(const delegate &other) const 
 		{
@@ -1325,7 +2400,7 @@ namespace delegates
 				return ( static_cast<const base_type&>(*this) == static_cast<const base_type&>(other) );
 			
 			if(m_pthis == other.m_pthis && m_free_func == other.m_free_func)
-				return detail::DelegateMementoHack::is_equal_pFunction((base_type(*this)).GetMemento(), (base_type(other)).GetMemento());
+				return detail::DelegateMementoHack::is_equal_pFunction(detail::DelegateMementoHack::get_memento(*this), detail::DelegateMementoHack::get_memento(other));
 			else
 				return false;
 		}
@@ -1337,48 +2412,74 @@ namespace delegates
 
 		bool operator<(const delegate &other) const 
 		{
+			const delegate_sort_key key = sort_key(), other_key = other.sort_key();
+			if(key != other_key)
+				return key < other_key;
 			if(!m_free_func && !other.m_free_func)
 				return ( static_cast<const base_type&>(*this) < static_cast<const base_type&>(other) );
 			if(m_pthis != other.m_pthis)
 				return m_pthis < other.m_pthis;
 			if(m_free_func != other.m_free_func)
 				return m_free_func < other.m_free_func;
-			return detail::DelegateMementoHack::is_less_pFunction((base_type(*this)).GetMemento(), (base_type(other)).GetMemento());
+			return detail::DelegateMementoHack::is_less_pFunction(detail::DelegateMementoHack::get_memento(*this), detail::DelegateMementoHack::get_memento(other));
 		}
 
 		bool operator>(const delegate &other) const 
 		{
-			if(!m_free_func && !other.m_free_func)
-				return ( static_cast<const base_type&>(*this) > static_cast<const base_type&>(other) );
-			if(m_pthis != other.m_pthis)
-				return m_pthis > other.m_pthis;
-			if(m_free_func != other.m_free_func)
-				return m_free_func > other.m_free_func;
-			return detail::DelegateMementoHack::is_less_pFunction((base_type(other)).GetMemento(), (base_type(*this)).GetMemento());
+			return other < *this;
+		}
+
+		std::size_t hash() const
+		{
+			const fastdelegate::DelegateMemento &memento = detail::DelegateMementoHack::get_memento(*this);
+			if(!m_free_func)
+				return detail::DelegateMementoHack::hash(memento);
+			std::size_t seed = detail::DelegateMementoHack::hash_pFunction(memento);
+			seed = detail::DelegateMementoHack::hash_combine(seed, reinterpret_cast<std::size_t>(m_pthis));
+			return detail::DelegateMementoHack::hash_combine(seed, reinterpret_cast<std::size_t>(m_free_func));
+		}
+
+		delegate_sort_key sort_key() const
+		{
+			if(!m_free_func)
+				return detail::DelegateMementoHack::sort_key(detail::DelegateMementoHack::get_memento(*this));
+			delegate_sort_key key;
+			key.code = reinterpret_cast<std::size_t>(m_free_func);
+			key.object = reinterpret_cast<std::size_t>(m_pthis);
+			return key;
 		}
 
 		template < class Y >
 		inline void bind(Y *pthis, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T)) {
 			this->clear();
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
 			m_pthis = static_cast<void*>(pthis);
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class Y >
 		inline void bind(Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T)) {
 			this->clear();
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
 			m_pthis = static_cast<void*>(pthis);
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class Y >
 		inline void bind(const Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T)) {
 			this->clear();
-			m_pthis = static_cast<void*>(pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class X, class Y >
@@ -1397,16 +2498,88 @@ namespace delegates
 			base_type::bind(pthis, function_to_bind);
 		}
 
+		// virtual function is resolved for 'pthis' once here instead of on every call,
+		// so 'pthis' must not change its dynamic type while bound (same as 'bind' if not supported by compiler)
+		template < class X, class Y >
+		inline void bind_devirtualized(Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T)) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::bind_devirtualized(*this, fastdelegate::detail::implicit_cast<X*>(pthis), function_to_bind))
+				return;
+			base_type::bind(pthis, function_to_bind);
+		}
+
+		template < class X, class Y >
+		inline void bind_devirtualized(const Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T) const) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::bind_devirtualized(*this, const_cast<X*>(fastdelegate::detail::implicit_cast<const X*>(pthis)), function_to_bind))
+				return;
+			base_type::bind(pthis, function_to_bind);
+		}
+
 		inline void bind(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T)) {
 			assert(NULL != function_to_bind);
 			m_pthis = NULL; m_free_func = NULL;
 			base_type::bind(function_to_bind);
 		}
 
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk<Y, function_to_bind>);
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk_const<Y, function_to_bind>);
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T) >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk_const<Y, function_to_bind>);
+		}
+
+#if DELEGATES_CPLUSPLUS >= 201103L
+		template < class LambdaT >
+		inline typename std::enable_if<detail::is_function_convertible<LambdaT, ReturnT(*)(Param1T, Param2T, Param3T, Param4T, Param5T)>::value>::type
+			bind(const LambdaT &lambda) {
+			bind(static_cast<ReturnT(*)(Param1T, Param2T, Param3T, Param4T, Param5T)>(lambda));
+		}
+
+		template < class FunctorT >
+		inline typename std::enable_if<detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T) const>::value>::type
+			bind(const FunctorT *functor) {
+			bind(functor, static_cast<ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T) const>(&FunctorT::operator()));
+		}
+
+		template < class FunctorT >
+		inline typename std::enable_if<!detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T) const>::value &&
+			detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T)>::value>::type
+			bind(FunctorT *functor) {
+			bind(functor, static_cast<ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T)>(&FunctorT::operator()));
+		}
+#endif
+
 	private:
 		void *m_pthis;
 		free_function_like_member_t m_free_func;
 
+		// proxy is bound to the delegate itself so only this case can't be copied bitwise:
+		// the copied memento calls the same proxy, only 'this' is patched
+		void rebind_proxy() DELEGATES_NOEXCEPT
+		{
+			detail::DelegateMementoHack::set_pthis(
+				const_cast<fastdelegate::DelegateMemento&>(detail::DelegateMementoHack::get_memento(*this)), this);
+		}
+
 		template< class Y >
 		ReturnT f_proxy(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5) const
 		{
@@ -1422,6 +2595,18 @@ namespace delegates
 
 			return reinterpret_cast<type_free_function_like_member_t>(m_free_func)(static_cast<const Y*>(m_pthis), p1, p2, p3, p4, p5);
 		}
+
+		template< class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T) >
+		ReturnT f_thunk(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5) const
+		{
+			return function_to_bind(reinterpret_cast<Y*>(const_cast<delegate*>(this)), p1, p2, p3, p4, p5);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T) >
+		ReturnT f_thunk_const(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5) const
+		{
+			return function_to_bind(reinterpret_cast<const Y*>(this), p1, p2, p3, p4, p5);
+		}
 	};
 
 	template<class ReturnT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T, class Param6T>
@@ -1484,26 +2669,32 @@ namespace delegates
 		template < class Y >
 		delegate(Y *pthis,
 			ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 		template < class Y >
 		delegate(Y *pthis,
 			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 		template < class Y >
 		delegate(const Y *pthis,
 			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 
 		delegate(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T))
@@ -1514,35 +2705,72 @@ namespace delegates
 			assert(NULL != function_to_bind);
 		}
 
-		delegate(const delegate &other)
+		delegate(const delegate &other) DELEGATES_NOEXCEPT
+			: base_type(other),
+			m_pthis(other.m_pthis),
+			m_free_func(other.m_free_func)
 		{
-			{
-				f_proxy_type proxy = &delegate::f_proxy<delegate>;
-				base_type::bind(this, proxy);
-				fastdelegate::DelegateMemento tmp = (base_type(other)).GetMemento();
-				if(other.m_free_func)
-					detail::DelegateMementoHack::copy_pthis(tmp, base_type::GetMemento());
-				base_type::SetMemento(tmp);
-			}
-			using namespace std;
-			memcpy(&m_pthis, &other.m_pthis, sizeof(m_pthis));
-			memcpy(&m_free_func, &other.m_free_func, sizeof(m_free_func));
+			if(m_free_func)
+				rebind_proxy();
 		}
 
-		void operator=(const delegate &other)
+		void operator=(const delegate &other) DELEGATES_NOEXCEPT
 		{
-			{
-				f_proxy_type proxy = &delegate::f_proxy<delegate>;
-				base_type::bind(this, proxy);
-				fastdelegate::DelegateMemento tmp = (base_type(other)).GetMemento();
-				if(other.m_free_func)
-					detail::DelegateMementoHack::copy_pthis(tmp, base_type::GetMemento());
-				base_type::SetMemento(tmp);
-			}
-			using namespace std;
-			memcpy(&m_pthis, &other.m_pthis, sizeof(m_pthis));
-			memcpy(&m_free_func, &other.m_free_func, sizeof(m_free_func));
+			base_type::operator=(other);
+			m_pthis = other.m_pthis;
+			m_free_func = other.m_free_func;
+			if(m_free_func)
+				rebind_proxy();
+		}
+
+#if DELEGATES_CPLUSPLUS >= 201103L
+		delegate(delegate &&other) DELEGATES_NOEXCEPT
+			: base_type(other),
+			m_pthis(other.m_pthis),
+			m_free_func(other.m_free_func)
+		{
+			if(m_free_func)
+				rebind_proxy();
+		}
+
+		void operator=(delegate &&other) DELEGATES_NOEXCEPT
+		{
+			operator=(static_cast<const delegate&>(other));
+		}
+
+		// captureless lambda is bound as static function
+		template < class LambdaT >
+		delegate(const LambdaT &lambda,
+			typename std::enable_if<detail::is_function_convertible<LambdaT, ReturnT(*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T)>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(lambda);
+		}
+
+		// functor (lambda with captures) is bound by pointer as its 'operator()', so it should outlive the delegate
+		template < class FunctorT >
+		delegate(const FunctorT *functor,
+			typename std::enable_if<detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) const>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(functor);
+		}
+
+		template < class FunctorT >
+		delegate(FunctorT *functor,
+			typename std::enable_if<!detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) const>::value &&
+				detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T)>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(functor);
 		}
+#endif
 		
 		bool operator==(const delegate &other) const 
 		{
@@ -1550,7 +2778,7 @@ namespace delegates
 				return ( static_cast<const base_type&>(*this) == static_cast<const base_type&>(other) );
 			
 			if(m_pthis == other.m_pthis && m_free_func == other.m_free_func)
-				return detail::DelegateMementoHack::is_equal_pFunction((base_type(*this)).GetMemento(), (base_type(other)).GetMemento());
+				return detail::DelegateMementoHack::is_equal_pFunction(detail::DelegateMementoHack::get_memento(*this), detail::DelegateMementoHack::get_memento(other));
 			else
 				return false;
 		}
@@ -1562,48 +2790,74 @@ namespace delegates
 
 		bool operator<(const delegate &other) const 
 		{
+			const delegate_sort_key key = sort_key(), other_key = other.sort_key();
+			if(key != other_key)
+				return key < other_key;
 			if(!m_free_func && !other.m_free_func)
 				return ( static_cast<const base_type&>(*this) < static_cast<const base_type&>(other) );
 			if(m_pthis != other.m_pthis)
 				return m_pthis < other.m_pthis;
 			if(m_free_func != other.m_free_func)
 				return m_free_func < other.m_free_func;
-			return detail::DelegateMementoHack::is_less_pFunction((base_type(*this)).GetMemento(), (base_type(other)).GetMemento());
+			return detail::DelegateMementoHack::is_less_pFunction(detail::DelegateMementoHack::get_memento(*this), detail::DelegateMementoHack::get_memento(other));
 		}
 
 		bool operator>(const delegate &other) const 
 		{
-			if(!m_free_func && !other.m_free_func)
-				return ( static_cast<const base_type&>(*this) > static_cast<const base_type&>(other) );
-			if(m_pthis != other.m_pthis)
-				return m_pthis > other.m_pthis;
-			if(m_free_func != other.m_free_func)
-				return m_free_func > other.m_free_func;
-			return detail::DelegateMementoHack::is_less_pFunction((base_type(other)).GetMemento(), (base_type(*this)).GetMemento());
+			return other < *this;
+		}
+
+		std::size_t hash() const
+		{
+			const fastdelegate::DelegateMemento &memento = detail::DelegateMementoHack::get_memento(*this);
+			if(!m_free_func)
+				return detail::DelegateMementoHack::hash(memento);
+			std::size_t seed = detail::DelegateMementoHack::hash_pFunction(memento);
+			seed = detail::DelegateMementoHack::hash_combine(seed, reinterpret_cast<std::size_t>(m_pthis));
+			return detail::DelegateMementoHack::hash_combine(seed, reinterpret_cast<std::size_t>(m_free_func));
+		}
+
+		delegate_sort_key sort_key() const
+		{
+			if(!m_free_func)
+				return detail::DelegateMementoHack::sort_key(detail::DelegateMementoHack::get_memento(*this));
+			delegate_sort_key key;
+			key.code = reinterpret_cast<std::size_t>(m_free_func);
+			key.object = reinterpret_cast<std::size_t>(m_pthis);
+			return key;
 		}
 
 		template < class Y >
 		inline void bind(Y *pthis, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T)) {
 			this->clear();
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
 			m_pthis = static_cast<void*>(pthis);
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class Y >
 		inline void bind(Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T)) {
 			this->clear();
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
 			m_pthis = static_cast<void*>(pthis);
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class Y >
 		inline void bind(const Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T)) {
 			this->clear();
-			m_pthis = static_cast<void*>(pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class X, class Y >
@@ -1622,16 +2876,88 @@ namespace delegates
 			base_type::bind(pthis, function_to_bind);
 		}
 
+		// virtual function is resolved for 'pthis' once here instead of on every call,
+		// so 'pthis' must not change its dynamic type while bound (same as 'bind' if not supported by compiler)
+		template < class X, class Y >
+		inline void bind_devirtualized(Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T)) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::bind_devirtualized(*this, fastdelegate::detail::implicit_cast<X*>(pthis), function_to_bind))
+				return;
+			base_type::bind(pthis, function_to_bind);
+		}
+
+		template < class X, class Y >
+		inline void bind_devirtualized(const Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) const) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::bind_devirtualized(*this, const_cast<X*>(fastdelegate::detail::implicit_cast<const X*>(pthis)), function_to_bind))
+				return;
+			base_type::bind(pthis, function_to_bind);
+		}
+
 		inline void bind(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T)) {
 			assert(NULL != function_to_bind);
 			m_pthis = NULL; m_free_func = NULL;
 			base_type::bind(function_to_bind);
 		}
 
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk<Y, function_to_bind>);
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk_const<Y, function_to_bind>);
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk_const<Y, function_to_bind>);
+		}
+
+#if DELEGATES_CPLUSPLUS >= 201103L
+		template < class LambdaT >
+		inline typename std::enable_if<detail::is_function_convertible<LambdaT, ReturnT(*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T)>::value>::type
+			bind(const LambdaT &lambda) {
+			bind(static_cast<ReturnT(*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T)>(lambda));
+		}
+
+		template < class FunctorT >
+		inline typename std::enable_if<detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) const>::value>::type
+			bind(const FunctorT *functor) {
+			bind(functor, static_cast<ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) const>(&FunctorT::operator()));
+		}
+
+		template < class FunctorT >
+		inline typename std::enable_if<!detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) const>::value &&
+			detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T)>::value>::type
+			bind(FunctorT *functor) {
+			bind(functor, static_cast<ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T)>(&FunctorT::operator()));
+		}
+#endif
+
 	private:
 		void *m_pthis;
 		free_function_like_member_t m_free_func;
 
+		// proxy is bound to the delegate itself so only this case can't be copied bitwise:
+		// the copied memento calls the same proxy, only 'this' is patched
+		void rebind_proxy() DELEGATES_NOEXCEPT
+		{
+			detail::DelegateMementoHack::set_pthis(
+				const_cast<fastdelegate::DelegateMemento&>(detail::DelegateMementoHack::get_memento(*this)), this);
+		}
+
 		template< class Y >
 		ReturnT f_proxy(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6) const
 		{
@@ -1647,6 +2973,18 @@ namespace delegates
 
 			return reinterpret_cast<type_free_function_like_member_t>(m_free_func)(static_cast<const Y*>(m_pthis), p1, p2, p3, p4, p5, p6);
 		}
+
+		template< class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+		ReturnT f_thunk(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6) const
+		{
+			return function_to_bind(reinterpret_cast<Y*>(const_cast<delegate*>(this)), p1, p2, p3, p4, p5, p6);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+		ReturnT f_thunk_const(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6) const
+		{
+			return function_to_bind(reinterpret_cast<const Y*>(this), p1, p2, p3, p4, p5, p6);
+		}
 	};
 
 	template<class ReturnT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T, class Param6T, class Param7T>
@@ -1708,26 +3046,32 @@ namespace delegates
 		template < class Y >
 		delegate(Y *pthis,
 			ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 		template < class Y >
 		delegate(Y *pthis,
 			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 		template < class Y >
 		delegate(const Y *pthis,
 			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 
 		delegate(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T))
@@ -1738,35 +3082,72 @@ namespace delegates
 			assert(NULL != function_to_bind);
 		}
 
-		delegate(const delegate &other)
+		delegate(const delegate &other) DELEGATES_NOEXCEPT
+			: base_type(other),
+			m_pthis(other.m_pthis),
+			m_free_func(other.m_free_func)
 		{
-			{
-				f_proxy_type proxy = &delegate::f_proxy<delegate>;
-				base_type::bind(this, proxy);
-				fastdelegate::DelegateMemento tmp = (base_type(other)).GetMemento();
-				if(other.m_free_func)
-					detail::DelegateMementoHack::copy_pthis(tmp, base_type::GetMemento());
-				base_type::SetMemento(tmp);
-			}
-			using namespace std;
-			memcpy(&m_pthis, &other.m_pthis, sizeof(m_pthis));
-			memcpy(&m_free_func, &other.m_free_func, sizeof(m_free_func));
+			if(m_free_func)
+				rebind_proxy();
 		}
 
-		void operator=(const delegate &other)
+		void operator=(const delegate &other) DELEGATES_NOEXCEPT
 		{
-			{
-				f_proxy_type proxy = &delegate::f_proxy<delegate>;
-				base_type::bind(this, proxy);
-				fastdelegate::DelegateMemento tmp = (base_type(other)).GetMemento();
-				if(other.m_free_func)
-					detail::DelegateMementoHack::copy_pthis(tmp, base_type::GetMemento());
-				base_type::SetMemento(tmp);
-			}
-			using namespace std;
-			memcpy(&m_pthis, &other.m_pthis, sizeof(m_pthis));
-			memcpy(&m_free_func, &other.m_free_func, sizeof(m_free_func));
+			base_type::operator=(other);
+			m_pthis = other.m_pthis;
+			m_free_func = other.m_free_func;
+			if(m_free_func)
+				rebind_proxy();
+		}
+
+#if DELEGATES_CPLUSPLUS >= 201103L
+		delegate(delegate &&other) DELEGATES_NOEXCEPT
+			: base_type(other),
+			m_pthis(other.m_pthis),
+			m_free_func(other.m_free_func)
+		{
+			if(m_free_func)
+				rebind_proxy();
+		}
+
+		void operator=(delegate &&other) DELEGATES_NOEXCEPT
+		{
+			operator=(static_cast<const delegate&>(other));
+		}
+
+		// captureless lambda is bound as static function
+		template < class LambdaT >
+		delegate(const LambdaT &lambda,
+			typename std::enable_if<detail::is_function_convertible<LambdaT, ReturnT(*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(lambda);
+		}
+
+		// functor (lambda with captures) is bound by pointer as its 'operator()', so it should outlive the delegate
+		template < class FunctorT >
+		delegate(const FunctorT *functor,
+			typename std::enable_if<detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) const>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(functor);
+		}
+
+		template < class FunctorT >
+		delegate(FunctorT *functor,
+			typename std::enable_if<!detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) const>::value &&
+				detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(functor);
 		}
+#endif
 		
 		bool operator==(const delegate &other) const 
 		{
@@ -1774,7 +3155,7 @@ namespace delegates
 				return ( static_cast<const base_type&>(*this) == static_cast<const base_type&>(other) );
 			
 			if(m_pthis == other.m_pthis && m_free_func == other.m_free_func)
-				return detail::DelegateMementoHack::is_equal_pFunction((base_type(*this)).GetMemento(), (base_type(other)).GetMemento());
+				return detail::DelegateMementoHack::is_equal_pFunction(detail::DelegateMementoHack::get_memento(*this), detail::DelegateMementoHack::get_memento(other));
 			else
 				return false;
 		}
@@ -1786,220 +3167,759 @@ namespace delegates
 
 		bool operator<(const delegate &other) const 
 		{
+			const delegate_sort_key key = sort_key(), other_key = other.sort_key();
+			if(key != other_key)
+				return key < other_key;
 			if(!m_free_func && !other.m_free_func)
 				return ( static_cast<const base_type&>(*this) < static_cast<const base_type&>(other) );
 			if(m_pthis != other.m_pthis)
 				return m_pthis < other.m_pthis;
 			if(m_free_func != other.m_free_func)
 				return m_free_func < other.m_free_func;
-			return detail::DelegateMementoHack::is_less_pFunction((base_type(*this)).GetMemento(), (base_type(other)).GetMemento());
+			return detail::DelegateMementoHack::is_less_pFunction(detail::DelegateMementoHack::get_memento(*this), detail::DelegateMementoHack::get_memento(other));
 		}
 
 		bool operator>(const delegate &other) const 
 		{
-			if(!m_free_func && !other.m_free_func)
-				return ( static_cast<const base_type&>(*this) > static_cast<const base_type&>(other) );
-			if(m_pthis != other.m_pthis)
-				return m_pthis > other.m_pthis;
-			if(m_free_func != other.m_free_func)
-				return m_free_func > other.m_free_func;
-			return detail::DelegateMementoHack::is_less_pFunction((base_type(other)).GetMemento(), (base_type(*this)).GetMemento());
+			return other < *this;
+		}
+
+		std::size_t hash() const
+		{
+			const fastdelegate::DelegateMemento &memento = detail::DelegateMementoHack::get_memento(*this);
+			if(!m_free_func)
+				return detail::DelegateMementoHack::hash(memento);
+			std::size_t seed = detail::DelegateMementoHack::hash_pFunction(memento);
+			seed = detail::DelegateMementoHack::hash_combine(seed, reinterpret_cast<std::size_t>(m_pthis));
+			return detail::DelegateMementoHack::hash_combine(seed, reinterpret_cast<std::size_t>(m_free_func));
+		}
+
+		delegate_sort_key sort_key() const
+		{
+			if(!m_free_func)
+				return detail::DelegateMementoHack::sort_key(detail::DelegateMementoHack::get_memento(*this));
+			delegate_sort_key key;
+			key.code = reinterpret_cast<std::size_t>(m_free_func);
+			key.object = reinterpret_cast<std::size_t>(m_pthis);
+			return key;
 		}
 
 		template < class Y >
 		inline void bind(Y *pthis, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)) {
 			this->clear();
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
 			m_pthis = static_cast<void*>(pthis);
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class Y >
 		inline void bind(Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)) {
 			this->clear();
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
 			m_pthis = static_cast<void*>(pthis);
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
+		}
+
+		template < class Y >
+		inline void bind(const Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)) {
+			this->clear();
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
+		}
+
+		template < class X, class Y >
+		inline void bind(Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(pthis, function_to_bind);
+		}
+
+		template < class X, class Y >
+		inline void bind(const Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) const) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(pthis, function_to_bind);
+		}
+
+		// virtual function is resolved for 'pthis' once here instead of on every call,
+		// so 'pthis' must not change its dynamic type while bound (same as 'bind' if not supported by compiler)
+		template < class X, class Y >
+		inline void bind_devirtualized(Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::bind_devirtualized(*this, fastdelegate::detail::implicit_cast<X*>(pthis), function_to_bind))
+				return;
+			base_type::bind(pthis, function_to_bind);
+		}
+
+		template < class X, class Y >
+		inline void bind_devirtualized(const Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) const) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::bind_devirtualized(*this, const_cast<X*>(fastdelegate::detail::implicit_cast<const X*>(pthis)), function_to_bind))
+				return;
+			base_type::bind(pthis, function_to_bind);
+		}
+
+		inline void bind(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)) {
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(function_to_bind);
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk<Y, function_to_bind>);
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk_const<Y, function_to_bind>);
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk_const<Y, function_to_bind>);
+		}
+
+#if DELEGATES_CPLUSPLUS >= 201103L
+		template < class LambdaT >
+		inline typename std::enable_if<detail::is_function_convertible<LambdaT, ReturnT(*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)>::value>::type
+			bind(const LambdaT &lambda) {
+			bind(static_cast<ReturnT(*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)>(lambda));
+		}
+
+		template < class FunctorT >
+		inline typename std::enable_if<detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) const>::value>::type
+			bind(const FunctorT *functor) {
+			bind(functor, static_cast<ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) const>(&FunctorT::operator()));
+		}
+
+		template < class FunctorT >
+		inline typename std::enable_if<!detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) const>::value &&
+			detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)>::value>::type
+			bind(FunctorT *functor) {
+			bind(functor, static_cast<ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)>(&FunctorT::operator()));
+		}
+#endif
+
+	private:
+		void *m_pthis;
+		free_function_like_member_t m_free_func;
+
+		// proxy is bound to the delegate itself so only this case can't be copied bitwise:
+		// the copied memento calls the same proxy, only 'this' is patched
+		void rebind_proxy() DELEGATES_NOEXCEPT
+		{
+			detail::DelegateMementoHack::set_pthis(
+				const_cast<fastdelegate::DelegateMemento&>(detail::DelegateMementoHack::get_memento(*this)), this);
+		}
+
+		template< class Y >
+		ReturnT f_proxy(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7) const
+		{
+			typedef ReturnT(*type_free_function_like_member_t)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T);
+
+			return reinterpret_cast<type_free_function_like_member_t>(m_free_func)(static_cast<Y*>(m_pthis), p1, p2, p3, p4, p5, p6, p7);
+		}
+
+		template< class Y >
+		ReturnT f_proxy_const(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7) const
+		{
+			typedef ReturnT(*type_free_function_like_member_t)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T);
+
+			return reinterpret_cast<type_free_function_like_member_t>(m_free_func)(static_cast<const Y*>(m_pthis), p1, p2, p3, p4, p5, p6, p7);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+		ReturnT f_thunk(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7) const
+		{
+			return function_to_bind(reinterpret_cast<Y*>(const_cast<delegate*>(this)), p1, p2, p3, p4, p5, p6, p7);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+		ReturnT f_thunk_const(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7) const
+		{
+			return function_to_bind(reinterpret_cast<const Y*>(this), p1, p2, p3, p4, p5, p6, p7);
+		}
+	};
+
+	template<class ReturnT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T, class Param6T, class Param7T, class Param8T>
+	class delegate<ReturnT, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T, detail::DefaultVoid> :
+		public fastdelegate::FastDelegate8<Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T, ReturnT>
+	{
+		typedef ReturnT(*free_function_like_member_t)(void*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T);
+		typedef ReturnT(*free_function_like_member_const_t)(const void*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T);
+
+		typedef ReturnT(delegate::* f_proxy_type)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) const;
+
+        template<class Y>
+        inline
+        f_proxy_type get_proxy(Y*, ReturnT(*)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)) const
+        { return &delegate::f_proxy<Y>; }
+
+        template<class Y>
+        inline
+        f_proxy_type get_proxy(Y*, ReturnT(*)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)) const
+        { return &delegate::f_proxy_const<Y>; }
+
+        template<class Y>
+        inline
+        f_proxy_type get_proxy(const Y*, ReturnT(*)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)) const
+        { return &delegate::f_proxy_const<Y>; }
+
+	public:
+		typedef fastdelegate::FastDelegate8<Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T, ReturnT> base_type;
+
+		typedef delegate type;
+
+		delegate() 
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)  
+		{ }
+
+		template < class X, class Y >
+		delegate(Y * pthis,
+			ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T))
+			: base_type(pthis, function_to_bind),
+			m_pthis(NULL),
+			m_free_func(NULL)  
+		{
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+		}
+
+		template < class X, class Y >
+		delegate(const Y *pthis,
+			ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) const)
+			: base_type(pthis, function_to_bind),
+			m_pthis(NULL),
+			m_free_func(NULL)  
+		{
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+		}
+
+		template < class Y >
+		delegate(Y *pthis,
+			ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T))
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
+
+		template < class Y >
+		delegate(Y *pthis,
+			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T))
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
+
+		template < class Y >
+		delegate(const Y *pthis,
+			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T))
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
+
+
+		delegate(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T))
+			: base_type(function_to_bind),
+			m_pthis(NULL),
+			m_free_func(NULL) 
+		{
+			assert(NULL != function_to_bind);
+		}
+
+		delegate(const delegate &other) DELEGATES_NOEXCEPT
+			: base_type(other),
+			m_pthis(other.m_pthis),
+			m_free_func(other.m_free_func)
+		{
+			if(m_free_func)
+				rebind_proxy();
+		}
+
+		void operator=(const delegate &other) DELEGATES_NOEXCEPT
+		{
+			base_type::operator=(other);
+			m_pthis = other.m_pthis;
+			m_free_func = other.m_free_func;
+			if(m_free_func)
+				rebind_proxy();
+		}
+
+#if DELEGATES_CPLUSPLUS >= 201103L
+		delegate(delegate &&other) DELEGATES_NOEXCEPT
+			: base_type(other),
+			m_pthis(other.m_pthis),
+			m_free_func(other.m_free_func)
+		{
+			if(m_free_func)
+				rebind_proxy();
+		}
+
+		void operator=(delegate &&other) DELEGATES_NOEXCEPT
+		{
+			operator=(static_cast<const delegate&>(other));
+		}
+
+		// captureless lambda is bound as static function
+		template < class LambdaT >
+		delegate(const LambdaT &lambda,
+			typename std::enable_if<detail::is_function_convertible<LambdaT, ReturnT(*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(lambda);
+		}
+
+		// functor (lambda with captures) is bound by pointer as its 'operator()', so it should outlive the delegate
+		template < class FunctorT >
+		delegate(const FunctorT *functor,
+			typename std::enable_if<detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) const>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(functor);
+		}
+
+		template < class FunctorT >
+		delegate(FunctorT *functor,
+			typename std::enable_if<!detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) const>::value &&
+				detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)>::value, int>::type = 0)
+			: base_type(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(functor);
+		}
+#endif
+		
+		bool operator==(const delegate &other) const 
+		{
+			if(!m_free_func && !other.m_free_func)
+				return ( static_cast<const base_type&>(*this) == static_cast<const base_type&>(other) );
+			
+			if(m_pthis == other.m_pthis && m_free_func == other.m_free_func)
+				return detail::DelegateMementoHack::is_equal_pFunction(detail::DelegateMementoHack::get_memento(*this), detail::DelegateMementoHack::get_memento(other));
+			else
+				return false;
+		}
+
+		bool operator!=(const delegate &other) const 
+		{
+			return !(*this == other);
+		}
+
+		bool operator<(const delegate &other) const 
+		{
+			const delegate_sort_key key = sort_key(), other_key = other.sort_key();
+			if(key != other_key)
+				return key < other_key;
+			if(!m_free_func && !other.m_free_func)
+				return ( static_cast<const base_type&>(*this) < static_cast<const base_type&>(other) );
+			if(m_pthis != other.m_pthis)
+				return m_pthis < other.m_pthis;
+			if(m_free_func != other.m_free_func)
+				return m_free_func < other.m_free_func;
+			return detail::DelegateMementoHack::is_less_pFunction(detail::DelegateMementoHack::get_memento(*this), detail::DelegateMementoHack::get_memento(other));
+		}
+
+		bool operator>(const delegate &other) const 
+		{
+			return other < *this;
+		}
+
+		std::size_t hash() const
+		{
+			const fastdelegate::DelegateMemento &memento = detail::DelegateMementoHack::get_memento(*this);
+			if(!m_free_func)
+				return detail::DelegateMementoHack::hash(memento);
+			std::size_t seed = detail::DelegateMementoHack::hash_pFunction(memento);
+			seed = detail::DelegateMementoHack::hash_combine(seed, reinterpret_cast<std::size_t>(m_pthis));
+			return detail::DelegateMementoHack::hash_combine(seed, reinterpret_cast<std::size_t>(m_free_func));
+		}
+
+		delegate_sort_key sort_key() const
+		{
+			if(!m_free_func)
+				return detail::DelegateMementoHack::sort_key(detail::DelegateMementoHack::get_memento(*this));
+			delegate_sort_key key;
+			key.code = reinterpret_cast<std::size_t>(m_free_func);
+			key.object = reinterpret_cast<std::size_t>(m_pthis);
+			return key;
+		}
+
+		template < class Y >
+		inline void bind(Y *pthis, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)) {
+			this->clear();
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
+			m_pthis = static_cast<void*>(pthis);
+			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
+		}
+
+		template < class Y >
+		inline void bind(Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)) {
+			this->clear();
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
+			m_pthis = static_cast<void*>(pthis);
+			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
+		}
+
+		template < class Y >
+		inline void bind(const Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)) {
+			this->clear();
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
+			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
+			base_type::bind(this, get_proxy(pthis, function_to_bind));
+		}
+
+		template < class X, class Y >
+		inline void bind(Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(pthis, function_to_bind);
 		}
 
-		template < class Y >
-		inline void bind(const Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)) {
-			this->clear();
-			m_pthis = static_cast<void*>(pthis);
-			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+		template < class X, class Y >
+		inline void bind(const Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) const) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(pthis, function_to_bind);
 		}
 
+		// virtual function is resolved for 'pthis' once here instead of on every call,
+		// so 'pthis' must not change its dynamic type while bound (same as 'bind' if not supported by compiler)
 		template < class X, class Y >
-		inline void bind(Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)) {
+		inline void bind_devirtualized(Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)) {
 			assert(NULL != pthis);
 			assert(NULL != function_to_bind);
 			m_pthis = NULL; m_free_func = NULL;
+			if(detail::bind_devirtualized(*this, fastdelegate::detail::implicit_cast<X*>(pthis), function_to_bind))
+				return;
 			base_type::bind(pthis, function_to_bind);
 		}
 
 		template < class X, class Y >
-		inline void bind(const Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) const) {
+		inline void bind_devirtualized(const Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) const) {
 			assert(NULL != pthis);
 			assert(NULL != function_to_bind);
 			m_pthis = NULL; m_free_func = NULL;
+			if(detail::bind_devirtualized(*this, const_cast<X*>(fastdelegate::detail::implicit_cast<const X*>(pthis)), function_to_bind))
+				return;
 			base_type::bind(pthis, function_to_bind);
 		}
 
-		inline void bind(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)) {
+		inline void bind(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)) {
 			assert(NULL != function_to_bind);
 			m_pthis = NULL; m_free_func = NULL;
 			base_type::bind(function_to_bind);
 		}
 
+		template < class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk<Y, function_to_bind>);
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk_const<Y, function_to_bind>);
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			base_type::bind(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk_const<Y, function_to_bind>);
+		}
+
+#if DELEGATES_CPLUSPLUS >= 201103L
+		template < class LambdaT >
+		inline typename std::enable_if<detail::is_function_convertible<LambdaT, ReturnT(*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)>::value>::type
+			bind(const LambdaT &lambda) {
+			bind(static_cast<ReturnT(*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)>(lambda));
+		}
+
+		template < class FunctorT >
+		inline typename std::enable_if<detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) const>::value>::type
+			bind(const FunctorT *functor) {
+			bind(functor, static_cast<ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) const>(&FunctorT::operator()));
+		}
+
+		template < class FunctorT >
+		inline typename std::enable_if<!detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) const>::value &&
+			detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)>::value>::type
+			bind(FunctorT *functor) {
+			bind(functor, static_cast<ReturnT(FunctorT::*)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)>(&FunctorT::operator()));
+		}
+#endif
+
 	private:
 		void *m_pthis;
 		free_function_like_member_t m_free_func;
 
+		// proxy is bound to the delegate itself so only this case can't be copied bitwise:
+		// the copied memento calls the same proxy, only 'this' is patched
+		void rebind_proxy() DELEGATES_NOEXCEPT
+		{
+			detail::DelegateMementoHack::set_pthis(
+				const_cast<fastdelegate::DelegateMemento&>(detail::DelegateMementoHack::get_memento(*this)), this);
+		}
+
 		template< class Y >
-		ReturnT f_proxy(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7) const
+		ReturnT f_proxy(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7, Param8T p8) const
 		{
-			typedef ReturnT(*type_free_function_like_member_t)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T);
+			typedef ReturnT(*type_free_function_like_member_t)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T);
 
-			return reinterpret_cast<type_free_function_like_member_t>(m_free_func)(static_cast<Y*>(m_pthis), p1, p2, p3, p4, p5, p6, p7);
+			return reinterpret_cast<type_free_function_like_member_t>(m_free_func)(static_cast<Y*>(m_pthis), p1, p2, p3, p4, p5, p6, p7, p8);
 		}
 
 		template< class Y >
-		ReturnT f_proxy_const(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7) const
+		ReturnT f_proxy_const(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7, Param8T p8) const
 		{
-			typedef ReturnT(*type_free_function_like_member_t)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T);
+			typedef ReturnT(*type_free_function_like_member_t)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T);
 
-			return reinterpret_cast<type_free_function_like_member_t>(m_free_func)(static_cast<const Y*>(m_pthis), p1, p2, p3, p4, p5, p6, p7);
+			return reinterpret_cast<type_free_function_like_member_t>(m_free_func)(static_cast<const Y*>(m_pthis), p1, p2, p3, p4, p5, p6, p7, p8);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+		ReturnT f_thunk(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7, Param8T p8) const
+		{
+			return function_to_bind(reinterpret_cast<Y*>(const_cast<delegate*>(this)), p1, p2, p3, p4, p5, p6, p7, p8);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+		ReturnT f_thunk_const(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7, Param8T p8) const
+		{
+			return function_to_bind(reinterpret_cast<const Y*>(this), p1, p2, p3, p4, p5, p6, p7, p8);
 		}
 	};
 
-	template<class ReturnT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T, class Param6T, class Param7T, class Param8T>
-	class delegate<ReturnT, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T, detail::DefaultVoid> :
-		public fastdelegate::FastDelegate8<Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T, ReturnT>
+#if DELEGATES_CPLUSPLUS >= 201103L
+	// variadic front-end: delegate<ReturnT(ParamsT...)>
+	// arguments are perfectly forwarded, so a by-value parameter is copied or moved straight into the bound member function
+	template<class ReturnT, class... ParamsT>
+	class delegate<ReturnT(ParamsT...), detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid, detail::DefaultVoid>
 	{
-		typedef ReturnT(*free_function_like_member_t)(void*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T);
-		typedef ReturnT(*free_function_like_member_const_t)(const void*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T);
+		typedef ReturnT(*free_function_like_member_t)(void*, ParamsT...);
+		typedef ReturnT(*static_function_t)(ParamsT...);
+		typedef ReturnT(fastdelegate::detail::GenericClass::*generic_member_function_t)(ParamsT...);
+		typedef fastdelegate::detail::ClosurePtr<generic_member_function_t, static_function_t, static_function_t> closure_type;
 
-		typedef ReturnT(delegate::* f_proxy_type)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) const;
+		typedef ReturnT(delegate::* f_proxy_type)(ParamsT...) const;
+
+		// must stay the first member: static function invoker relies on it
+		closure_type m_closure;
 
         template<class Y>
         inline
-        f_proxy_type get_proxy(Y*, ReturnT(*)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)) const
+        f_proxy_type get_proxy(Y*, ReturnT(*)(Y*, ParamsT...)) const
         { return &delegate::f_proxy<Y>; }
 
         template<class Y>
         inline
-        f_proxy_type get_proxy(Y*, ReturnT(*)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)) const
+        f_proxy_type get_proxy(Y*, ReturnT(*)(const Y*, ParamsT...)) const
         { return &delegate::f_proxy_const<Y>; }
 
         template<class Y>
         inline
-        f_proxy_type get_proxy(const Y*, ReturnT(*)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T)) const
+        f_proxy_type get_proxy(const Y*, ReturnT(*)(const Y*, ParamsT...)) const
         { return &delegate::f_proxy_const<Y>; }
 
 	public:
-		typedef fastdelegate::FastDelegate8<Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T, ReturnT> base_type;
-
 		typedef delegate type;
 
-		delegate() 
-			: base_type(),
+		delegate() DELEGATES_NOEXCEPT
+			: m_closure(),
 			m_pthis(NULL),
-			m_free_func(NULL)  
+			m_free_func(NULL)
 		{ }
 
 		template < class X, class Y >
 		delegate(Y * pthis,
-			ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T))
-			: base_type(pthis, function_to_bind),
+			ReturnT(X::* function_to_bind)(ParamsT...))
+			: m_closure(),
 			m_pthis(NULL),
-			m_free_func(NULL)  
+			m_free_func(NULL)
 		{
-			assert(NULL != pthis);
-			assert(NULL != function_to_bind);
+			bind(pthis, function_to_bind);
 		}
 
 		template < class X, class Y >
 		delegate(const Y *pthis,
-			ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) const)
-			: base_type(pthis, function_to_bind),
+			ReturnT(X::* function_to_bind)(ParamsT...) const)
+			: m_closure(),
 			m_pthis(NULL),
-			m_free_func(NULL)  
+			m_free_func(NULL)
 		{
-			assert(NULL != pthis);
-			assert(NULL != function_to_bind);
+			bind(pthis, function_to_bind);
 		}
 
 		template < class Y >
 		delegate(Y *pthis,
-			ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			ReturnT(*function_to_bind)(Y*, ParamsT...))
+			: m_closure(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 		template < class Y >
 		delegate(Y *pthis,
-			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			ReturnT(*function_to_bind)(const Y*, ParamsT...))
+			: m_closure(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
 		template < class Y >
 		delegate(const Y *pthis,
-			ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T))
-			: base_type(this, get_proxy(pthis, function_to_bind)),
-			m_pthis(static_cast<void*>(pthis)),
-			m_free_func(reinterpret_cast<free_function_like_member_t>(function_to_bind))
-		{ }
+			ReturnT(*function_to_bind)(const Y*, ParamsT...))
+			: m_closure(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(pthis, function_to_bind);
+		}
 
+		delegate(ReturnT(*function_to_bind)(ParamsT...))
+			: m_closure(),
+			m_pthis(NULL),
+			m_free_func(NULL)
+		{
+			bind(function_to_bind);
+		}
 
-		delegate(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T))
-			: base_type(function_to_bind),
+		// captureless lambda is bound as static function
+		template < class LambdaT >
+		delegate(const LambdaT &lambda,
+			typename std::enable_if<detail::is_function_convertible<LambdaT, ReturnT(*)(ParamsT...)>::value, int>::type = 0)
+			: m_closure(),
 			m_pthis(NULL),
-			m_free_func(NULL) 
+			m_free_func(NULL)
 		{
-			assert(NULL != function_to_bind);
+			bind(lambda);
 		}
 
-		delegate(const delegate &other)
+		// functor (lambda with captures) is bound by pointer as its 'operator()', so it should outlive the delegate
+		template < class FunctorT >
+		delegate(const FunctorT *functor,
+			typename std::enable_if<detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(ParamsT...) const>::value, int>::type = 0)
+			: m_closure(),
+			m_pthis(NULL),
+			m_free_func(NULL)
 		{
-			{
-				f_proxy_type proxy = &delegate::f_proxy<delegate>;
-				base_type::bind(this, proxy);
-				fastdelegate::DelegateMemento tmp = (base_type(other)).GetMemento();
-				if(other.m_free_func)
-					detail::DelegateMementoHack::copy_pthis(tmp, base_type::GetMemento());
-				base_type::SetMemento(tmp);
-			}
-			using namespace std;
-			memcpy(&m_pthis, &other.m_pthis, sizeof(m_pthis));
-			memcpy(&m_free_func, &other.m_free_func, sizeof(m_free_func));
+			bind(functor);
 		}
 
-		void operator=(const delegate &other)
+		template < class FunctorT >
+		delegate(FunctorT *functor,
+			typename std::enable_if<!detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(ParamsT...) const>::value &&
+				detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(ParamsT...)>::value, int>::type = 0)
+			: m_closure(),
+			m_pthis(NULL),
+			m_free_func(NULL)
 		{
-			{
-				f_proxy_type proxy = &delegate::f_proxy<delegate>;
-				base_type::bind(this, proxy);
-				fastdelegate::DelegateMemento tmp = (base_type(other)).GetMemento();
-				if(other.m_free_func)
-					detail::DelegateMementoHack::copy_pthis(tmp, base_type::GetMemento());
-				base_type::SetMemento(tmp);
-			}
-			using namespace std;
-			memcpy(&m_pthis, &other.m_pthis, sizeof(m_pthis));
-			memcpy(&m_free_func, &other.m_free_func, sizeof(m_free_func));
+			bind(functor);
 		}
-		
+
+		delegate(const delegate &other) DELEGATES_NOEXCEPT
+			: m_closure(),
+			m_pthis(other.m_pthis),
+			m_free_func(other.m_free_func)
+		{
+			m_closure.CopyFrom(this, other.m_closure);
+			if(m_free_func)
+				rebind_proxy();
+		}
+
+		delegate(delegate &&other) DELEGATES_NOEXCEPT
+			: m_closure(),
+			m_pthis(other.m_pthis),
+			m_free_func(other.m_free_func)
+		{
+			m_closure.CopyFrom(this, other.m_closure);
+			if(m_free_func)
+				rebind_proxy();
+		}
+
+		void operator=(const delegate &other) DELEGATES_NOEXCEPT
+		{
+			m_closure.CopyFrom(this, other.m_closure);
+			m_pthis = other.m_pthis;
+			m_free_func = other.m_free_func;
+			if(m_free_func)
+				rebind_proxy();
+		}
+
+		void operator=(delegate &&other) DELEGATES_NOEXCEPT
+		{
+			operator=(static_cast<const delegate&>(other));
+		}
+
+		template<class... ArgsT>
+		inline ReturnT operator()(ArgsT&&... args) const
+		{
+			return (m_closure.GetClosureThis()->*(m_closure.GetClosureMemPtr()))(std::forward<ArgsT>(args)...);
+		}
+
 		bool operator==(const delegate &other) const 
 		{
 			if(!m_free_func && !other.m_free_func)
-				return ( static_cast<const base_type&>(*this) == static_cast<const base_type&>(other) );
+				return m_closure.IsEqual(other.m_closure);
 			
 			if(m_pthis == other.m_pthis && m_free_func == other.m_free_func)
-				return detail::DelegateMementoHack::is_equal_pFunction((base_type(*this)).GetMemento(), (base_type(other)).GetMemento());
+				return detail::DelegateMementoHack::is_equal_pFunction(m_closure, other.m_closure);
 			else
 				return false;
 		}
@@ -2011,92 +3931,239 @@ namespace delegates
 
 		bool operator<(const delegate &other) const 
 		{
+			const delegate_sort_key key = sort_key(), other_key = other.sort_key();
+			if(key != other_key)
+				return key < other_key;
 			if(!m_free_func && !other.m_free_func)
-				return ( static_cast<const base_type&>(*this) < static_cast<const base_type&>(other) );
+				return m_closure.IsLess(other.m_closure);
 			if(m_pthis != other.m_pthis)
 				return m_pthis < other.m_pthis;
 			if(m_free_func != other.m_free_func)
 				return m_free_func < other.m_free_func;
-			return detail::DelegateMementoHack::is_less_pFunction((base_type(*this)).GetMemento(), (base_type(other)).GetMemento());
+			return detail::DelegateMementoHack::is_less_pFunction(m_closure, other.m_closure);
 		}
 
 		bool operator>(const delegate &other) const 
 		{
-			if(!m_free_func && !other.m_free_func)
-				return ( static_cast<const base_type&>(*this) > static_cast<const base_type&>(other) );
-			if(m_pthis != other.m_pthis)
-				return m_pthis > other.m_pthis;
-			if(m_free_func != other.m_free_func)
-				return m_free_func > other.m_free_func;
-			return detail::DelegateMementoHack::is_less_pFunction((base_type(other)).GetMemento(), (base_type(*this)).GetMemento());
+			return other < *this;
+		}
+
+		std::size_t hash() const
+		{
+			const fastdelegate::DelegateMemento &memento = detail::DelegateMementoHack::get_memento(*this);
+			if(!m_free_func)
+				return detail::DelegateMementoHack::hash(memento);
+			std::size_t seed = detail::DelegateMementoHack::hash_pFunction(memento);
+			seed = detail::DelegateMementoHack::hash_combine(seed, reinterpret_cast<std::size_t>(m_pthis));
+			return detail::DelegateMementoHack::hash_combine(seed, reinterpret_cast<std::size_t>(m_free_func));
+		}
+
+		delegate_sort_key sort_key() const
+		{
+			if(!m_free_func)
+				return detail::DelegateMementoHack::sort_key(detail::DelegateMementoHack::get_memento(*this));
+			delegate_sort_key key;
+			key.code = reinterpret_cast<std::size_t>(m_free_func);
+			key.object = reinterpret_cast<std::size_t>(m_pthis);
+			return key;
+		}
+
+		explicit operator bool() const
+		{
+			return !empty();
+		}
+
+		inline bool operator!() const
+		{
+			return empty();
+		}
+
+		inline bool empty() const
+		{
+			return !m_closure;
+		}
+
+		void clear()
+		{
+			m_closure.clear();
+			m_pthis = NULL; m_free_func = NULL;
+		}
+
+		const fastdelegate::DelegateMemento& GetMemento() const
+		{
+			return m_closure;
+		}
+
+		void SetMemento(const fastdelegate::DelegateMemento &any)
+		{
+			m_closure.CopyFrom(this, any);
+			m_pthis = NULL; m_free_func = NULL;
 		}
 
 		template < class Y >
-		inline void bind(Y *pthis, ReturnT(*function_to_bind)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)) {
-			this->clear();
+		inline void bind(Y *pthis, ReturnT(*function_to_bind)(Y*, ParamsT...)) {
+			clear();
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
 			m_pthis = static_cast<void*>(pthis);
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			m_closure.bindconstmemfunc(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class Y >
-		inline void bind(Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)) {
-			this->clear();
+		inline void bind(Y *pthis, ReturnT(*function_to_bind)(const Y*, ParamsT...)) {
+			clear();
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
 			m_pthis = static_cast<void*>(pthis);
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			m_closure.bindconstmemfunc(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class Y >
-		inline void bind(const Y *pthis, ReturnT(*function_to_bind)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)) {
-			this->clear();
-			m_pthis = static_cast<void*>(pthis);
+		inline void bind(const Y *pthis, ReturnT(*function_to_bind)(const Y*, ParamsT...)) {
+			clear();
+			if(detail::DelegateMementoHack::bind_free_function(*this, pthis, function_to_bind))
+				return;
+			m_pthis = const_cast<void*>(static_cast<const void*>(pthis));
 			m_free_func = reinterpret_cast<free_function_like_member_t>(function_to_bind);
-			bind(this, get_proxy(pthis, function_to_bind));
+			m_closure.bindconstmemfunc(this, get_proxy(pthis, function_to_bind));
 		}
 
 		template < class X, class Y >
-		inline void bind(Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)) {
+		inline void bind(Y *pthis, ReturnT(X::* function_to_bind)(ParamsT...)) {
 			assert(NULL != pthis);
 			assert(NULL != function_to_bind);
 			m_pthis = NULL; m_free_func = NULL;
-			base_type::bind(pthis, function_to_bind);
+			m_closure.bindmemfunc(fastdelegate::detail::implicit_cast<X*>(pthis), function_to_bind);
 		}
 
 		template < class X, class Y >
-		inline void bind(const Y *pthis, ReturnT(X::* function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) const) {
+		inline void bind(const Y *pthis, ReturnT(X::* function_to_bind)(ParamsT...) const) {
 			assert(NULL != pthis);
 			assert(NULL != function_to_bind);
 			m_pthis = NULL; m_free_func = NULL;
-			base_type::bind(pthis, function_to_bind);
+			m_closure.bindconstmemfunc(fastdelegate::detail::implicit_cast<const X*>(pthis), function_to_bind);
 		}
 
-		inline void bind(ReturnT(*function_to_bind)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T)) {
+		// virtual function is resolved for 'pthis' once here instead of on every call,
+		// so 'pthis' must not change its dynamic type while bound (same as 'bind' if not supported by compiler)
+		template < class X, class Y >
+		inline void bind_devirtualized(Y *pthis, ReturnT(X::* function_to_bind)(ParamsT...)) {
+			assert(NULL != pthis);
 			assert(NULL != function_to_bind);
 			m_pthis = NULL; m_free_func = NULL;
-			base_type::bind(function_to_bind);
+			if(detail::bind_devirtualized(*this, fastdelegate::detail::implicit_cast<X*>(pthis), function_to_bind))
+				return;
+			m_closure.bindmemfunc(fastdelegate::detail::implicit_cast<X*>(pthis), function_to_bind);
+		}
+
+		template < class X, class Y >
+		inline void bind_devirtualized(const Y *pthis, ReturnT(X::* function_to_bind)(ParamsT...) const) {
+			assert(NULL != pthis);
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			if(detail::bind_devirtualized(*this, const_cast<X*>(fastdelegate::detail::implicit_cast<const X*>(pthis)), function_to_bind))
+				return;
+			m_closure.bindconstmemfunc(fastdelegate::detail::implicit_cast<const X*>(pthis), function_to_bind);
+		}
+
+		inline void bind(ReturnT(*function_to_bind)(ParamsT...)) {
+			assert(NULL != function_to_bind);
+			m_pthis = NULL; m_free_func = NULL;
+			m_closure.bindstaticfunc(this, &delegate::invoke_static_function, function_to_bind);
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(Y*, ParamsT...) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			m_closure.bindconstmemfunc(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk<Y, function_to_bind>);
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, ParamsT...) >
+		inline void bind(Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			m_closure.bindconstmemfunc(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk_const<Y, function_to_bind>);
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(const Y*, ParamsT...) >
+		inline void bind(const Y *pthis) {
+			assert(NULL != pthis);
+			m_pthis = NULL; m_free_func = NULL;
+			m_closure.bindconstmemfunc(reinterpret_cast<const delegate*>(pthis), &delegate::f_thunk_const<Y, function_to_bind>);
+		}
+
+		template < class LambdaT >
+		inline typename std::enable_if<detail::is_function_convertible<LambdaT, ReturnT(*)(ParamsT...)>::value>::type
+			bind(const LambdaT &lambda) {
+			bind(static_cast<ReturnT(*)(ParamsT...)>(lambda));
+		}
+
+		template < class FunctorT >
+		inline typename std::enable_if<detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(ParamsT...) const>::value>::type
+			bind(const FunctorT *functor) {
+			bind(functor, static_cast<ReturnT(FunctorT::*)(ParamsT...) const>(&FunctorT::operator()));
+		}
+
+		template < class FunctorT >
+		inline typename std::enable_if<!detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(ParamsT...) const>::value &&
+			detail::has_call_operator<FunctorT, ReturnT(FunctorT::*)(ParamsT...)>::value>::type
+			bind(FunctorT *functor) {
+			bind(functor, static_cast<ReturnT(FunctorT::*)(ParamsT...)>(&FunctorT::operator()));
 		}
 
 	private:
 		void *m_pthis;
 		free_function_like_member_t m_free_func;
 
+		// proxy is bound to the delegate itself so only this case can't be copied bitwise:
+		// the copied closure calls the same proxy, only 'this' is patched
+		void rebind_proxy() DELEGATES_NOEXCEPT
+		{
+			detail::DelegateMementoHack::set_pthis(m_closure, this);
+		}
+
+		// the invokers below take by-value parameters once and move them on to the target,
+		// only bound member functions (and free functions bound without a proxy) are reached without this extra move.
+		// Known limit: the invoker is called through the member function pointer of the delegate signature, so it
+		// could not take the parameters by reference without breaking the calling convention of by-value ones
+
+		ReturnT invoke_static_function(ParamsT... params) const
+		{
+			return (*(m_closure.GetStaticFunction()))(std::forward<ParamsT>(params)...);
+		}
+
 		template< class Y >
-		ReturnT f_proxy(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7, Param8T p8) const
+		ReturnT f_proxy(ParamsT... params) const
 		{
-			typedef ReturnT(*type_free_function_like_member_t)(Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T);
+			typedef ReturnT(*type_free_function_like_member_t)(Y*, ParamsT...);
 
-			return reinterpret_cast<type_free_function_like_member_t>(m_free_func)(static_cast<Y*>(m_pthis), p1, p2, p3, p4, p5, p6, p7, p8);
+			return reinterpret_cast<type_free_function_like_member_t>(m_free_func)(static_cast<Y*>(m_pthis), std::forward<ParamsT>(params)...);
 		}
 
 		template< class Y >
-		ReturnT f_proxy_const(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7, Param8T p8) const
+		ReturnT f_proxy_const(ParamsT... params) const
 		{
-			typedef ReturnT(*type_free_function_like_member_t)(const Y*, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T);
+			typedef ReturnT(*type_free_function_like_member_t)(const Y*, ParamsT...);
 
-			return reinterpret_cast<type_free_function_like_member_t>(m_free_func)(static_cast<const Y*>(m_pthis), p1, p2, p3, p4, p5, p6, p7, p8);
+			return reinterpret_cast<type_free_function_like_member_t>(m_free_func)(static_cast<const Y*>(m_pthis), std::forward<ParamsT>(params)...);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(Y*, ParamsT...) >
+		ReturnT f_thunk(ParamsT... params) const
+		{
+			return function_to_bind(reinterpret_cast<Y*>(const_cast<delegate*>(this)), std::forward<ParamsT>(params)...);
+		}
+
+		template< class Y, ReturnT(*function_to_bind)(const Y*, ParamsT...) >
+		ReturnT f_thunk_const(ParamsT... params) const
+		{
+			return function_to_bind(reinterpret_cast<const Y*>(this), std::forward<ParamsT>(params)...);
 		}
 	};
+#endif
 
 	template < class X, class Y, class ReturnT >
 	delegate<ReturnT>
@@ -2448,7 +4515,87 @@ namespace delegates
 	{
 		return delegate<ReturnT, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T>(function_to_bind);
 	}
+
+#if DELEGATES_CPLUSPLUS >= 201103L
+	namespace detail
+	{
+		template<class MemFuncT>
+		struct call_operator_delegate;
+
+		template<class ReturnT, class FunctorT, class... ParamsT>
+		struct call_operator_delegate<ReturnT(FunctorT::*)(ParamsT...) const>
+		{
+			typedef delegate<ReturnT, ParamsT...> type;
+			typedef ReturnT(*function_type)(ParamsT...);
+		};
+
+		template<class ReturnT, class FunctorT, class... ParamsT>
+		struct call_operator_delegate<ReturnT(FunctorT::*)(ParamsT...)>
+		{
+			typedef delegate<ReturnT, ParamsT...> type;
+			typedef ReturnT(*function_type)(ParamsT...);
+		};
+	}
+
+	// signature of the delegate is taken from the (single, non-template) 'operator()' of lambda or functor
+
+	template < class LambdaT >
+	typename std::enable_if<
+		detail::is_function_convertible<LambdaT, typename detail::call_operator_delegate<decltype(&LambdaT::operator())>::function_type>::value,
+		typename detail::call_operator_delegate<decltype(&LambdaT::operator())>::type
+	>::type
+		bind(const LambdaT &lambda)
+	{
+		return typename detail::call_operator_delegate<decltype(&LambdaT::operator())>::type(lambda);
+	}
+
+	template < class FunctorT >
+	typename detail::call_operator_delegate<decltype(&FunctorT::operator())>::type
+		bind(FunctorT *functor)
+	{
+		return typename detail::call_operator_delegate<decltype(&FunctorT::operator())>::type(functor);
+	}
+#endif
+
+#if DELEGATES_CPLUSPLUS >= 201703L
+	namespace detail
+	{
+		template<class FunctionT>
+		struct thunk_delegate;
+
+		template<class ReturnT, class Y, class... ParamsT>
+		struct thunk_delegate<ReturnT(*)(Y*, ParamsT...)>
+		{
+			typedef delegate<ReturnT, ParamsT...> type;
+		};
+	}
+
+	// 'bind<&function>(pthis)' - same as 'bind(pthis, &function)' but the function is known at compile time
+	// so the call goes straight to it without a proxy in between
+	template < auto function_to_bind, class Y >
+	typename detail::thunk_delegate<decltype(function_to_bind)>::type
+		bind(Y *pthis)
+	{
+		typename detail::thunk_delegate<decltype(function_to_bind)>::type result;
+		result.template bind<typename std::remove_const<Y>::type, function_to_bind>(pthis);
+		return result;
+	}
+#endif
+}
+
+#if DELEGATES_CPLUSPLUS >= 201103L
+namespace std
+{
+	template<class ReturnT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T, class Param6T, class Param7T, class Param8T, class ParamUnusedT>
+	struct hash<delegates::delegate<ReturnT, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T, ParamUnusedT> >
+	{
+		std::size_t operator()(const delegates::delegate<ReturnT, Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T, ParamUnusedT> &value) const DELEGATES_NOEXCEPT
+		{
+			return value.hash();
+		}
+	};
 }
+#endif
 
 
 #endif // DELEGATE_H
@@ -0,0 +1,249 @@
+#ifndef INPLACE_DELEGATE_H
+#define INPLACE_DELEGATE_H
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+//owning delegate: small callable (lambda, functor) is stored inside the delegate itself, no heap allocation
+
+/******************************************************************************************************************************/
+/* 'delegates::inplace_delegate<return_type(param_type1, param_type2), capacity>' could be bound to any callable object       */
+/* (lambda with captures, functor, function pointer, 'delegate') of size up to 'capacity' bytes:                              */
+/*                                                                                                                            */
+/*   inplace_delegate<void(int)> d = [counter, &log](int value) mutable { log.push_back(value + counter++); };                */
+/*                                                                                                                            */
+/* The callable is copied (or moved) into the delegate; bigger callables or ones with alignment stricter than                 */
+/* 'alignof(std::max_align_t)' are rejected at compile time. The call is one indirect call of the thunk generated for the     */
+/* type of the callable, arguments are forwarded to it. Trivially copyable callables (captureless lambdas, lambdas capturing  */
+/* pointers and numbers) are copied with 'memcpy', others through the manager function generated for their type.              */
+/* Requires C++11.                                                                                                            */
+/*                                                                                                                            */
+/******************************************************************************************************************************/
+
+#include "delegate.h"
+
+#if DELEGATES_CPLUSPLUS < 201103L
+#error "inplace_delegate requires C++11"
+#else
+
+#include <cstddef>
+#include <new>
+
+namespace delegates
+{
+	namespace detail
+	{
+		template<class ParamT, class ArgT>
+		struct forwards_in_place :
+			std::integral_constant<bool,
+				std::is_reference<ParamT>::value ||
+				(!std::is_lvalue_reference<ArgT>::value && std::is_same<typename std::remove_cv<typename std::remove_reference<ArgT>::type>::type, ParamT>::value)>
+		{ };
+
+		// passes argument on to the parameter taken as 'ParamT&&' by the thunk: rvalue of the same type goes by reference,
+		// anything else is converted to temporary 'ParamT' at the call site, so by-value parameter is moved at most once
+		template<class ParamT, class ArgT>
+		inline
+		typename std::enable_if<forwards_in_place<ParamT, ArgT>::value, ArgT&&>::type
+			forward_parameter(typename std::remove_reference<ArgT>::type &arg)
+		{
+			return static_cast<ArgT&&>(arg);
+		}
+
+		template<class ParamT, class ArgT>
+		inline
+		typename std::enable_if<!forwards_in_place<ParamT, ArgT>::value, ParamT>::type
+			forward_parameter(typename std::remove_reference<ArgT>::type &arg)
+		{
+			return static_cast<ArgT&&>(arg);
+		}
+	}
+
+	template<class SignatureT, std::size_t Capacity = 4 * sizeof(void*)>
+	class inplace_delegate;
+
+	template<class ReturnT, class... ParamsT, std::size_t Capacity>
+	class inplace_delegate<ReturnT(ParamsT...), Capacity>
+	{
+		enum operation
+		{
+			copy_operation,
+			move_operation, // moves and destroys the source
+			destroy_operation
+		};
+
+		typedef ReturnT(*thunk_type)(void*, ParamsT&&...);
+		typedef void(*manager_type)(operation, void*, void*);
+
+		template<class FunctorT>
+		struct is_inplace_delegate : std::false_type { };
+
+		template<std::size_t OtherCapacity>
+		struct is_inplace_delegate<inplace_delegate<ReturnT(ParamsT...), OtherCapacity> > : std::true_type { };
+
+	public:
+		typedef inplace_delegate type;
+
+		static const std::size_t capacity = Capacity;
+
+		inplace_delegate() DELEGATES_NOEXCEPT
+			: m_thunk(NULL),
+			m_manager(NULL)
+		{ }
+
+		template<class FunctorT, class = typename std::enable_if<!is_inplace_delegate<typename std::decay<FunctorT>::type>::value>::type>
+		inplace_delegate(FunctorT &&functor)
+			: m_thunk(NULL),
+			m_manager(NULL)
+		{
+			bind(std::forward<FunctorT>(functor));
+		}
+
+		inplace_delegate(const inplace_delegate &other)
+			: m_thunk(NULL),
+			m_manager(NULL)
+		{
+			copy_from(other);
+		}
+
+		inplace_delegate(inplace_delegate &&other) DELEGATES_NOEXCEPT
+			: m_thunk(NULL),
+			m_manager(NULL)
+		{
+			move_from(other);
+		}
+
+		~inplace_delegate()
+		{
+			clear();
+		}
+
+		inplace_delegate& operator=(const inplace_delegate &other)
+		{
+			if(this != &other)
+			{
+				clear();
+				copy_from(other);
+			}
+			return *this;
+		}
+
+		inplace_delegate& operator=(inplace_delegate &&other) DELEGATES_NOEXCEPT
+		{
+			if(this != &other)
+			{
+				clear();
+				move_from(other);
+			}
+			return *this;
+		}
+
+		template<class FunctorT>
+		inline void bind(FunctorT &&functor) {
+			typedef typename std::decay<FunctorT>::type functor_type;
+
+			static_assert(sizeof(functor_type) <= Capacity,
+				"callable is too big for this inplace_delegate, increase its capacity");
+			static_assert(alignof(functor_type) <= alignof(std::max_align_t),
+				"callable is over-aligned for inplace_delegate");
+			static_assert(std::is_copy_constructible<functor_type>::value,
+				"callable stored in inplace_delegate must be copy constructible");
+			static_assert(std::is_nothrow_move_constructible<functor_type>::value,
+				"callable stored in inplace_delegate must be nothrow move constructible");
+
+			clear();
+			::new(static_cast<void*>(m_storage)) functor_type(std::forward<FunctorT>(functor));
+			m_thunk = &inplace_delegate::f_thunk<functor_type>;
+			m_manager = is_trivially_managed<functor_type>::value ? NULL : &inplace_delegate::f_manager<functor_type>;
+		}
+
+		template<class... ArgsT>
+		inline ReturnT operator()(ArgsT&&... args) const
+		{
+			return m_thunk(m_storage, detail::forward_parameter<ParamsT, ArgsT>(args)...);
+		}
+
+		explicit operator bool() const
+		{
+			return !empty();
+		}
+
+		inline bool operator!() const
+		{
+			return empty();
+		}
+
+		inline bool empty() const
+		{
+			return NULL == m_thunk;
+		}
+
+		void clear() DELEGATES_NOEXCEPT
+		{
+			if(m_manager)
+				m_manager(destroy_operation, m_storage, NULL);
+			m_thunk = NULL;
+			m_manager = NULL;
+		}
+
+	private:
+		alignas(std::max_align_t) mutable unsigned char m_storage[Capacity];
+		thunk_type m_thunk;
+		manager_type m_manager;
+
+		template<class FunctorT>
+		struct is_trivially_managed :
+			std::integral_constant<bool, std::is_trivially_copyable<FunctorT>::value && std::is_trivially_destructible<FunctorT>::value>
+		{ };
+
+		void copy_from(const inplace_delegate &other)
+		{
+			if(other.m_manager)
+				other.m_manager(copy_operation, m_storage, other.m_storage);
+			else
+				std::memcpy(m_storage, other.m_storage, Capacity);
+			m_thunk = other.m_thunk;
+			m_manager = other.m_manager;
+		}
+
+		void move_from(inplace_delegate &other) DELEGATES_NOEXCEPT
+		{
+			if(other.m_manager)
+				other.m_manager(move_operation, m_storage, other.m_storage);
+			else
+				std::memcpy(m_storage, other.m_storage, Capacity);
+			m_thunk = other.m_thunk;
+			m_manager = other.m_manager;
+			other.m_thunk = NULL;
+			other.m_manager = NULL;
+		}
+
+		template<class FunctorT>
+		static ReturnT f_thunk(void *storage, ParamsT&&... params)
+		{
+			return (*static_cast<FunctorT*>(storage))(std::forward<ParamsT>(params)...);
+		}
+
+		template<class FunctorT>
+		static void f_manager(operation op, void *to, void *from)
+		{
+			switch(op)
+			{
+			case copy_operation:
+				::new(to) FunctorT(*static_cast<const FunctorT*>(from));
+				break;
+			case move_operation:
+				::new(to) FunctorT(std::move(*static_cast<FunctorT*>(from)));
+				static_cast<FunctorT*>(from)->~FunctorT();
+				break;
+			case destroy_operation:
+				static_cast<FunctorT*>(to)->~FunctorT();
+				break;
+			}
+		}
+	};
+}
+
+#endif // DELEGATES_CPLUSPLUS < 201103L
+
+#endif // INPLACE_DELEGATE_H
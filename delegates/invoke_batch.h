@@ -0,0 +1,320 @@
+#ifndef INVOKE_BATCH_H
+#define INVOKE_BATCH_H
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+//batch calls: one delegate called for every element of argument arrays, the target is resolved once per batch
+
+/******************************************************************************************************************************/
+/* 'delegates::invoke_batch(delegate, count, results, param1_array, param2_array)' calls the delegate 'count' times with      */
+/* the elements of the argument arrays, storing the results (pass NULL for 'void' delegates):                                 */
+/*                                                                                                                            */
+/*   delegate<double, int, float> score(&model, &Model::score);                                                               */
+/*                                                                                                                            */
+/*   invoke_batch(score, count, scores, ids, weights); // scores[i] = model.score(ids[i], weights[i])                         */
+/*                                                                                                                            */
+/* The object and the code address are taken from the delegate once (with DELEGATES_ITANIUM_MFP virtual function is looked    */
+/* up once too), then called in a loop. Arrays of by-value parameters are taken as 'const param_type*', arrays of reference   */
+/* parameters as pointers to the referenced type.                                                                             */
+/* 'delegates::batch_delegate<return_type(param_type1, param_type2)>' is a delegate that could also be called for a batch     */
+/* with 'invoke(count, results, param1_array, param2_array)'. If it is bound at compile time, the loop is generated for the   */
+/* function it is bound to, so the function could be inlined into it. A target could also handle the whole batch itself:      */
+/* functor with 'operator()(size_t count, return_type *results, const param_type1 *param1_array, ...)' overload (or any       */
+/* delegate with this signature given to the constructor) is called once per batch instead of once per element.               */
+/* Requires C++11.                                                                                                            */
+/*                                                                                                                            */
+/******************************************************************************************************************************/
+
+#include "delegate.h"
+
+#if DELEGATES_CPLUSPLUS < 201103L
+#error "invoke_batch requires C++11"
+#else
+
+#include <cstddef>
+
+namespace delegates
+{
+	namespace detail
+	{
+		// by-value parameters are read from 'const param_type' arrays, references point into arrays of the referenced type
+		template<class ParamT>
+		struct batch_array
+		{
+			typedef const typename std::decay<ParamT>::type *type;
+		};
+
+		template<class ParamT>
+		struct batch_array<ParamT&>
+		{
+			typedef ParamT *type;
+		};
+
+		template<class ParamT>
+		struct batch_array<ParamT&&>
+		{
+			typedef ParamT *type;
+		};
+
+		template<class ReturnT>
+		struct batch_results
+		{
+			typedef ReturnT *type;
+		};
+
+		template<>
+		struct batch_results<void>
+		{
+			typedef void *type;
+		};
+
+		template<class ReturnT>
+		struct batch_loop
+		{
+			template<class CallT, class... ArraysT>
+			static void run(const CallT &call, std::size_t count, ReturnT *results, ArraysT... arrays)
+			{
+				for(std::size_t i = 0; i < count; ++i)
+					results[i] = call(arrays[i]...);
+			}
+		};
+
+		template<>
+		struct batch_loop<void>
+		{
+			template<class CallT, class... ArraysT>
+			static void run(const CallT &call, std::size_t count, void *, ArraysT... arrays)
+			{
+				for(std::size_t i = 0; i < count; ++i)
+					call(arrays[i]...);
+			}
+		};
+
+		template<class FunctionT>
+		struct batch_invoker;
+
+		template<class ReturnT, class... ParamsT>
+		struct batch_invoker<ReturnT(*)(ParamsT...)>
+		{
+			typedef typename batch_results<ReturnT>::type results_type;
+
+			static void run(const fastdelegate::DelegateMemento &memento, std::size_t count, results_type results,
+				typename batch_array<ParamsT>::type... arrays)
+			{
+				typedef ReturnT(fastdelegate::detail::GenericClass::*member_function_type)(ParamsT...);
+
+				member_function_type function;
+				fastdelegate::detail::GenericClass *pthis = DelegateMementoHack::get_closure(memento, function);
+#ifdef DELEGATES_ITANIUM_MFP
+				ReturnT(*code)(void*, ParamsT...);
+				void *adjusted_this = resolve_member_function(pthis, function, code);
+				batch_loop<ReturnT>::run(
+					[adjusted_this, code](typename std::remove_pointer<typename batch_array<ParamsT>::type>::type&... params) -> ReturnT
+					{
+						return code(adjusted_this, params...);
+					},
+					count, results, arrays...);
+#else
+				batch_loop<ReturnT>::run(
+					[pthis, function](typename std::remove_pointer<typename batch_array<ParamsT>::type>::type&... params) -> ReturnT
+					{
+						return (pthis->*function)(params...);
+					},
+					count, results, arrays...);
+#endif
+			}
+		};
+
+		// 'delegate<return_type, param_type1, ...>' has the (single) 'operator()' of 'FastDelegateN'
+		template<class DelegateT>
+		struct batch_signature
+		{
+			typedef typename call_operator_delegate<decltype(&DelegateT::operator())>::function_type function_type;
+		};
+
+		template<class ReturnT, class... ParamsT>
+		struct batch_signature<delegate<ReturnT(ParamsT...)> >
+		{
+			typedef ReturnT(*function_type)(ParamsT...);
+		};
+
+		template<class FunctionT>
+		struct batch_return;
+
+		template<class ReturnT, class... ParamsT>
+		struct batch_return<ReturnT(*)(ParamsT...)>
+		{
+			typedef typename batch_results<ReturnT>::type type;
+		};
+	}
+
+	template<class DelegateT, class... ArraysT>
+	void invoke_batch(const DelegateT &delegate_to_call, std::size_t count,
+		typename detail::batch_return<typename detail::batch_signature<DelegateT>::function_type>::type results,
+		ArraysT... arrays)
+	{
+		assert(!delegate_to_call.empty());
+		if(0 == count)
+			return;
+
+		detail::batch_invoker<typename detail::batch_signature<DelegateT>::function_type>::run(
+			detail::DelegateMementoHack::get_memento(delegate_to_call), count, results, arrays...);
+	}
+
+	template<class SignatureT>
+	class batch_delegate;
+
+	template<class ReturnT, class... ParamsT>
+	class batch_delegate<ReturnT(ParamsT...)>
+	{
+	public:
+		typedef batch_delegate type;
+		typedef delegate<ReturnT(ParamsT...)> delegate_type;
+		typedef typename detail::batch_results<ReturnT>::type results_type;
+		typedef delegate<void(std::size_t, results_type, typename detail::batch_array<ParamsT>::type...)> batch_delegate_type;
+
+		batch_delegate()
+		{ }
+
+		batch_delegate(const delegate_type &delegate_to_call)
+			: m_delegate(delegate_to_call)
+		{ }
+
+		// 'batch_to_call' handles whole batches, 'delegate_to_call' single calls
+		batch_delegate(const delegate_type &delegate_to_call, const batch_delegate_type &batch_to_call)
+			: m_delegate(delegate_to_call),
+			m_batch(batch_to_call)
+		{ }
+
+		// functor with 'operator()' taking the batch is called once per batch
+		template<class FunctorT>
+		batch_delegate(FunctorT *functor,
+			typename std::enable_if<std::is_class<FunctorT>::value, int>::type = 0)
+			: m_delegate(functor)
+		{
+			bind_batch_operator(functor, has_batch_operator<typename std::remove_const<FunctorT>::type>());
+		}
+
+		template < class Y, ReturnT(*function_to_bind)(Y*, ParamsT...) >
+		inline void bind(Y *pthis) {
+			m_delegate.template bind<Y, function_to_bind>(pthis);
+			m_batch.template bind<Y, &batch_delegate::f_batch<Y, function_to_bind> >(pthis);
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(ParamsT...) >
+		inline void bind(Y *pthis) {
+			m_delegate.bind(pthis, function_to_bind);
+			m_batch.template bind<Y, &batch_delegate::f_batch_member<Y, function_to_bind> >(pthis);
+		}
+
+		template < class Y, ReturnT(Y::*function_to_bind)(ParamsT...) const >
+		inline void bind(const Y *pthis) {
+			m_delegate.bind(pthis, function_to_bind);
+			m_batch.template bind<Y, &batch_delegate::f_batch_const_member<Y, function_to_bind> >(pthis);
+		}
+
+		template<class... ArgsT>
+		inline ReturnT operator()(ArgsT&&... args) const
+		{
+			return m_delegate(std::forward<ArgsT>(args)...);
+		}
+
+		void invoke(std::size_t count, results_type results, typename detail::batch_array<ParamsT>::type... arrays) const
+		{
+			if(!m_batch.empty())
+				m_batch(count, results, arrays...);
+			else
+				invoke_batch(m_delegate, count, results, arrays...);
+		}
+
+		inline const delegate_type& get_delegate() const
+		{
+			return m_delegate;
+		}
+
+		inline const batch_delegate_type& get_batch_delegate() const
+		{
+			return m_batch;
+		}
+
+		explicit operator bool() const
+		{
+			return !empty();
+		}
+
+		inline bool operator!() const
+		{
+			return empty();
+		}
+
+		inline bool empty() const
+		{
+			return m_delegate.empty();
+		}
+
+		void clear()
+		{
+			m_delegate.clear();
+			m_batch.clear();
+		}
+
+	private:
+		delegate_type m_delegate;
+		batch_delegate_type m_batch; // empty if batches are called element by element
+
+		template<class FunctorT>
+		struct has_batch_operator :
+			std::integral_constant<bool,
+				detail::has_call_operator<FunctorT, void(FunctorT::*)(std::size_t, results_type, typename detail::batch_array<ParamsT>::type...) const>::value ||
+				detail::has_call_operator<FunctorT, void(FunctorT::*)(std::size_t, results_type, typename detail::batch_array<ParamsT>::type...)>::value>
+		{ };
+
+		template<class FunctorT>
+		void bind_batch_operator(FunctorT *functor, std::true_type)
+		{
+			m_batch = batch_delegate_type(functor);
+		}
+
+		template<class FunctorT>
+		void bind_batch_operator(FunctorT *, std::false_type)
+		{ }
+
+		template< class Y, ReturnT(*function_to_bind)(Y*, ParamsT...) >
+		static void f_batch(Y *pthis, std::size_t count, results_type results, typename detail::batch_array<ParamsT>::type... arrays)
+		{
+			detail::batch_loop<ReturnT>::run(
+				[pthis](typename std::remove_pointer<typename detail::batch_array<ParamsT>::type>::type&... params) -> ReturnT
+				{
+					return function_to_bind(pthis, params...);
+				},
+				count, results, arrays...);
+		}
+
+		template< class Y, ReturnT(Y::*function_to_bind)(ParamsT...) >
+		static void f_batch_member(Y *pthis, std::size_t count, results_type results, typename detail::batch_array<ParamsT>::type... arrays)
+		{
+			detail::batch_loop<ReturnT>::run(
+				[pthis](typename std::remove_pointer<typename detail::batch_array<ParamsT>::type>::type&... params) -> ReturnT
+				{
+					return (pthis->*function_to_bind)(params...);
+				},
+				count, results, arrays...);
+		}
+
+		template< class Y, ReturnT(Y::*function_to_bind)(ParamsT...) const >
+		static void f_batch_const_member(const Y *pthis, std::size_t count, results_type results, typename detail::batch_array<ParamsT>::type... arrays)
+		{
+			detail::batch_loop<ReturnT>::run(
+				[pthis](typename std::remove_pointer<typename detail::batch_array<ParamsT>::type>::type&... params) -> ReturnT
+				{
+					return (pthis->*function_to_bind)(params...);
+				},
+				count, results, arrays...);
+		}
+	};
+}
+
+#endif // DELEGATES_CPLUSPLUS < 201103L
+
+#endif // INVOKE_BATCH_H
@@ -0,0 +1,239 @@
+#ifndef MULTICAST_DELEGATE_H
+#define MULTICAST_DELEGATE_H
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+//multicast delegate (event): list of subscribers called in order, stored as two dense arrays of object and code pointers
+
+/******************************************************************************************************************************/
+/* 'delegates::multicast_delegate<return_type(param_type1, param_type2)>' (or 'delegates::event<...>') holds any number of    */
+/* 'compact_delegate<return_type, param_type1, param_type2>' subscribers:                                                     */
+/*                                                                                                                            */
+/*   event<void(int)> on_value;                                                                                               */
+/*                                                                                                                            */
+/*   on_value += compact_delegate<void, int>(&obj, &Object::set_value);                                                       */
+/*   on_value(42); // calls every subscriber in the order they were added                                                     */
+/*                                                                                                                            */
+/* Subscribers are kept as parallel arrays - object pointers and code pointers - so the broadcast is a loop of indirect calls */
+/* over contiguous memory with no proxies in between. Arguments are passed to each subscriber as lvalues, return values are   */
+/* discarded, unless the call is made with 'invoke(combiner, arguments...)' (see "combiners.h"), which could also stop early. */
+/* 'remove' takes out the last subscriber equal to the given one, keeping the order of the rest.                              */
+/* Subscribers added with a priority ('add(subscriber, priority)') are called before the ones with lower priority (default    */
+/* is 0). Multicast delegate constructed with 'grouped_order' calls subscribers of the same priority grouped by the code they */
+/* call (instead of the order they were added), so with many subscribers bound to a few functions consecutive calls go to     */
+/* the same function and indirect branches are predicted; within a group the order they were added is kept.                   */
+/* Subscribers must not add or remove subscribers of the same multicast delegate while it is being called.                    */
+/* Requires C++11.                                                                                                            */
+/*                                                                                                                            */
+/******************************************************************************************************************************/
+
+#include "compact_delegate.h"
+#include "combiners.h"
+
+#if DELEGATES_CPLUSPLUS < 201103L
+#error "multicast_delegate requires C++11"
+#else
+
+#include <vector>
+
+namespace delegates
+{
+	enum multicast_order
+	{
+		insertion_order,
+		grouped_order // grouped by the code subscribers call
+	};
+
+	template<class ReturnT, class... ParamsT>
+	class multicast_delegate<ReturnT(ParamsT...)>
+	{
+	public:
+		typedef multicast_delegate type;
+		typedef compact_delegate<ReturnT, ParamsT...> delegate_type;
+
+	private:
+		typedef typename delegate_type::thunk_type thunk_type;
+
+	public:
+		explicit multicast_delegate(multicast_order order = insertion_order)
+			: m_order(order)
+		{ }
+
+		// subscribers with higher priority are called first
+		void add(const delegate_type &subscriber, int priority = 0)
+		{
+			if(subscriber.empty())
+				return;
+
+			const std::size_t position = insert_position(priority, code_of(subscriber.m_thunk, subscriber.m_pthis));
+
+			m_objects.insert(m_objects.begin() + position, subscriber.m_pthis);
+			try
+			{
+				m_thunks.insert(m_thunks.begin() + position, subscriber.m_thunk);
+				try
+				{
+					m_priorities.insert(m_priorities.begin() + position, priority);
+				}
+				catch(...)
+				{
+					m_thunks.erase(m_thunks.begin() + position);
+					throw;
+				}
+			}
+			catch(...)
+			{
+				m_objects.erase(m_objects.begin() + position);
+				throw;
+			}
+		}
+
+		bool remove(const delegate_type &subscriber)
+		{
+			for(std::size_t i = m_thunks.size(); i-- > 0;)
+			{
+				if(m_thunks[i] == subscriber.m_thunk && m_objects[i] == subscriber.m_pthis)
+				{
+					m_objects.erase(m_objects.begin() + i);
+					m_thunks.erase(m_thunks.begin() + i);
+					m_priorities.erase(m_priorities.begin() + i);
+					return true;
+				}
+			}
+			return false;
+		}
+
+		bool contains(const delegate_type &subscriber) const
+		{
+			for(std::size_t i = 0; i < m_thunks.size(); ++i)
+			{
+				if(m_thunks[i] == subscriber.m_thunk && m_objects[i] == subscriber.m_pthis)
+					return true;
+			}
+			return false;
+		}
+
+		multicast_delegate& operator+=(const delegate_type &subscriber)
+		{
+			add(subscriber);
+			return *this;
+		}
+
+		multicast_delegate& operator-=(const delegate_type &subscriber)
+		{
+			remove(subscriber);
+			return *this;
+		}
+
+		template<class... ArgsT>
+		void operator()(ArgsT&&... args) const
+		{
+			void *const *objects = m_objects.data();
+			const thunk_type *thunks = m_thunks.data();
+			const std::size_t count = m_thunks.size();
+
+			for(std::size_t i = 0; i < count; ++i)
+				thunks[i](objects[i], args...);
+		}
+
+		// each returned value is given to 'combiner' (see "combiners.h"), the call stops when it returns false
+		template<class CombinerT, class... ArgsT>
+		CombinerT invoke(CombinerT combiner, ArgsT&&... args) const
+		{
+			void *const *objects = m_objects.data();
+			const thunk_type *thunks = m_thunks.data();
+			const std::size_t count = m_thunks.size();
+
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				if(!combiner(thunks[i](objects[i], args...)))
+					break;
+			}
+			return combiner;
+		}
+
+		delegate_type operator[](std::size_t index) const
+		{
+			return delegate_type(m_thunks[index], m_objects[index]);
+		}
+
+		inline std::size_t size() const
+		{
+			return m_thunks.size();
+		}
+
+		inline multicast_order order() const
+		{
+			return m_order;
+		}
+
+		inline bool empty() const
+		{
+			return m_thunks.empty();
+		}
+
+		void reserve(std::size_t count)
+		{
+			m_objects.reserve(count);
+			m_thunks.reserve(count);
+			m_priorities.reserve(count);
+		}
+
+		void clear()
+		{
+			m_objects.clear();
+			m_thunks.clear();
+			m_priorities.clear();
+		}
+
+	private:
+		std::vector<void*> m_objects;
+		std::vector<thunk_type> m_thunks;
+		std::vector<int> m_priorities; // only used to find where new subscribers go
+		multicast_order m_order;
+
+		// free functions are all called through the same thunk, the function itself is the object pointer
+		static std::size_t code_of(thunk_type thunk, void *pthis)
+		{
+			if(thunk == &delegate_type::static_function_thunk)
+				return reinterpret_cast<std::size_t>(pthis);
+			return reinterpret_cast<std::size_t>(thunk);
+		}
+
+		// subscriber at 'index' is called after the new one with 'priority' and 'code'
+		bool is_called_after(std::size_t index, int priority, std::size_t code) const
+		{
+			if(m_priorities[index] != priority)
+				return m_priorities[index] < priority;
+			if(grouped_order == m_order)
+				return code_of(m_thunks[index], m_objects[index]) > code;
+			return false;
+		}
+
+		// subscribers are kept ordered by priority (and code for 'grouped_order'), the new one goes after its equals
+		std::size_t insert_position(int priority, std::size_t code) const
+		{
+			std::size_t first = 0, count = m_thunks.size();
+			while(count > 0)
+			{
+				const std::size_t step = count / 2;
+				if(!is_called_after(first + step, priority, code))
+				{
+					first += step + 1;
+					count -= step + 1;
+				}
+				else
+					count = step;
+			}
+			return first;
+		}
+	};
+
+	template<class SignatureT>
+	using event = multicast_delegate<SignatureT>;
+}
+
+#endif // DELEGATES_CPLUSPLUS < 201103L
+
+#endif // MULTICAST_DELEGATE_H
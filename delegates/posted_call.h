@@ -0,0 +1,390 @@
+#ifndef POSTED_CALL_H
+#define POSTED_CALL_H
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+//coroutine awaits a delegate called on another executor, no std::function, futures or heap allocation on the way
+
+/******************************************************************************************************************************/
+/* 'co_await delegates::call_on(executor, delegate, arguments...)' posts the call to the executor (anything with              */
+/* 'bool post(const delegate<void()>&)': 'thread_pool<void()>', 'deferred_queue<void()>', ...), suspends the coroutine and    */
+/* resumes it on the executor thread with the value returned by the delegate (or rethrows what the delegate has thrown):      */
+/*                                                                                                                            */
+/*   thread_pool<void()> workers;                                                                                             */
+/*                                                                                                                            */
+/*   size_t size = co_await call_on(workers, delegate<size_t(const Image&)>(&codec, &Codec::compress), image);                */
+/*                                                                                                                            */
+/* The awaitable holds the delegate, copies of the arguments and the result; it lives in the frame of the awaiting coroutine  */
+/* and the executor gets a delegate bound to it, so nothing is allocated per call. To continue on the original thread, await  */
+/* a call posted back to its executor. If the executor refuses the call ('post' returns false), the call is made by the       */
+/* awaiting thread and the coroutine is not suspended.                                                                        */
+/* 'delegates::pooled_frame' is a base for promise types: coroutine frames are taken from per-thread free lists of blocks     */
+/* rounded up to 64 bytes (up to 1024 bytes with the header, larger frames are not pooled), so once the lists are filled,     */
+/* starting a coroutine does not allocate either:                                                                             */
+/*                                                                                                                            */
+/*   struct request { struct promise_type : delegates::pooled_frame { ... }; };                                               */
+/*                                                                                                                            */
+/* A frame freed by another thread (the coroutine has finished on the executor) is handed back to the thread that allocated   */
+/* it through a lock-free list; the lists are freed when their thread exits.                                                  */
+/* Requires C++20.                                                                                                            */
+/*                                                                                                                            */
+/******************************************************************************************************************************/
+
+#include "deferred_call.h"
+
+#if DELEGATES_CPLUSPLUS < 202002L
+#error "posted_call requires C++20"
+#else
+
+#include <coroutine>
+#include <exception>
+#include <atomic>
+#include <new>
+
+namespace delegates
+{
+	namespace detail
+	{
+		// the value returned by the call, kept until the coroutine is resumed
+		template<class ReturnT>
+		class call_result
+		{
+		public:
+			call_result()
+				: m_has_value(false)
+			{ }
+
+			~call_result()
+			{
+				if(m_has_value)
+					get().~ReturnT();
+			}
+
+			template<class CallT>
+			void set(CallT &call)
+			{
+				new(&m_value) ReturnT(call.run());
+				m_has_value = true;
+			}
+
+			ReturnT take()
+			{
+				return std::move(get());
+			}
+
+		private:
+			typename std::aligned_storage<sizeof(ReturnT), std::alignment_of<ReturnT>::value>::type m_value;
+			bool m_has_value;
+
+			ReturnT& get()
+			{
+				return *reinterpret_cast<ReturnT*>(&m_value);
+			}
+		};
+
+		template<class ReturnT>
+		class call_result<ReturnT&>
+		{
+		public:
+			template<class CallT>
+			void set(CallT &call)
+			{
+				m_value = &call.run();
+			}
+
+			ReturnT& take()
+			{
+				return *m_value;
+			}
+
+		private:
+			ReturnT *m_value;
+		};
+
+		template<>
+		class call_result<void>
+		{
+		public:
+			template<class CallT>
+			void set(CallT &call)
+			{
+				call.run();
+			}
+
+			void take()
+			{ }
+		};
+
+		// per-thread free lists of coroutine frames; a block starts with the header naming the pool that allocated it,
+		// frames freed by other threads are pushed to the lock-free list of that pool and taken back in one exchange
+		class frame_pool
+		{
+		public:
+			static frame_pool& this_thread()
+			{
+				static thread_local pool_owner owner(acquire());
+				return *owner.pool;
+			}
+
+			void* allocate(std::size_t size)
+			{
+				const std::size_t size_class = (size + sizeof(block_header) - 1) / granularity;
+				block_header *header;
+				if(size_class >= class_count)
+					header = static_cast<block_header*>(::operator new(sizeof(block_header) + size));
+				else
+				{
+					free_block *block = m_free[size_class];
+					if(NULL == block) // frames freed by other threads
+						block = m_remote[size_class].exchange(NULL, std::memory_order_acquire);
+
+					if(NULL == block)
+						header = static_cast<block_header*>(::operator new((size_class + 1) * granularity));
+					else
+					{
+						m_free[size_class] = block->next;
+						header = reinterpret_cast<block_header*>(block);
+					}
+				}
+#if defined(__GNUC__) || defined(__clang__)
+				// hide the origin of the block from optimizer so it does not warn that the frame is not freed by '::operator delete'
+				__asm__("" : "+r"(header));
+#endif
+				header->owner = this;
+				header->size_class = size_class;
+				return header + 1;
+			}
+
+			void deallocate(void *frame) noexcept
+			{
+				block_header *header = static_cast<block_header*>(frame) - 1;
+				const std::size_t size_class = header->size_class;
+				if(size_class >= class_count)
+				{
+					::operator delete(header);
+					return;
+				}
+
+				free_block *block = reinterpret_cast<free_block*>(header);
+				if(header->owner == this)
+				{
+					block->next = m_free[size_class];
+					m_free[size_class] = block;
+				}
+				else
+					header->owner->push_remote(block, size_class);
+			}
+
+		private:
+			static const std::size_t granularity = 64;
+			static const std::size_t class_count = 16;
+
+			struct block_header
+			{
+				frame_pool *owner;
+				std::size_t size_class; // 'class_count' for frames that are not pooled
+			};
+
+			struct free_block
+			{
+				free_block *next;
+			};
+
+			struct pool_owner
+			{
+				explicit pool_owner(frame_pool *pool)
+					: pool(pool)
+				{ }
+
+				~pool_owner()
+				{
+					pool->close();
+				}
+
+				frame_pool *pool;
+			};
+
+			free_block *m_free[class_count];
+			std::atomic<free_block*> m_remote[class_count]; // 'closed_list()' while no thread owns the pool
+			std::atomic<bool> m_in_use;
+			frame_pool *m_next;
+
+			frame_pool()
+				: m_in_use(true),
+				m_next(NULL)
+			{
+				for(std::size_t i = 0; i < class_count; ++i)
+				{
+					m_free[i] = NULL;
+					m_remote[i].store(NULL, std::memory_order_relaxed);
+				}
+			}
+
+			frame_pool(const frame_pool&);
+			void operator=(const frame_pool&);
+
+			static std::atomic<frame_pool*>& pools()
+			{
+				static std::atomic<frame_pool*> head(NULL);
+				return head;
+			}
+
+			static free_block* closed_list()
+			{
+				static free_block closed;
+				return &closed;
+			}
+
+			// pools are never deleted (frames freed by other threads could still name them), the ones of exited threads are reused
+			static frame_pool* acquire()
+			{
+				for(frame_pool *pool = pools().load(std::memory_order_acquire); pool; pool = pool->m_next)
+				{
+					bool expected = false;
+					if(!pool->m_in_use.load(std::memory_order_relaxed) &&
+						pool->m_in_use.compare_exchange_strong(expected, true, std::memory_order_acquire))
+					{
+						for(std::size_t i = 0; i < class_count; ++i)
+							pool->m_remote[i].store(NULL, std::memory_order_release);
+						return pool;
+					}
+				}
+
+				frame_pool *pool = new frame_pool();
+				frame_pool *head = pools().load(std::memory_order_relaxed);
+				do
+				{
+					pool->m_next = head;
+				}
+				while(!pools().compare_exchange_weak(head, pool, std::memory_order_release, std::memory_order_relaxed));
+				return pool;
+			}
+
+			void push_remote(free_block *block, std::size_t size_class)
+			{
+				free_block *head = m_remote[size_class].load(std::memory_order_relaxed);
+				do
+				{
+					if(closed_list() == head) // the owner thread has exited
+					{
+						::operator delete(block);
+						return;
+					}
+					block->next = head;
+				}
+				while(!m_remote[size_class].compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_relaxed));
+			}
+
+			// the owner thread exits: cached frames are freed, frames freed later by other threads are deleted right away
+			void close()
+			{
+				for(std::size_t i = 0; i < class_count; ++i)
+				{
+					free_block *lists[2] = { m_free[i], m_remote[i].exchange(closed_list(), std::memory_order_acquire) };
+					m_free[i] = NULL;
+					for(free_block *block : lists)
+					{
+						while(block)
+						{
+							free_block *next = block->next;
+							::operator delete(block);
+							block = next;
+						}
+					}
+				}
+				m_in_use.store(false, std::memory_order_release);
+			}
+		};
+	}
+
+	struct pooled_frame
+	{
+		static void* operator new(std::size_t size)
+		{
+			return detail::frame_pool::this_thread().allocate(size);
+		}
+
+		static void operator delete(void *frame) noexcept
+		{
+			detail::frame_pool::this_thread().deallocate(frame);
+		}
+	};
+
+	template<class ExecutorT, class SignatureT>
+	class posted_call;
+
+	template<class ExecutorT, class ReturnT, class... ParamsT>
+	class posted_call<ExecutorT, ReturnT(ParamsT...)>
+	{
+	public:
+		typedef posted_call type;
+		typedef delegate<ReturnT(ParamsT...)> delegate_type;
+
+		template<class... ArgsT>
+		posted_call(ExecutorT &executor, const delegate_type &call_to_post, ArgsT&&... args)
+			: m_executor(executor),
+			m_call(call_to_post, std::forward<ArgsT>(args)...)
+		{ }
+
+		inline bool await_ready() const noexcept
+		{
+			return false;
+		}
+
+		bool await_suspend(std::coroutine_handle<> awaiting)
+		{
+			m_awaiting = awaiting;
+			if(m_executor.post(delegate<void()>(this, &posted_call::run_and_resume)))
+				return true; // the coroutine could be running on the executor already, nothing is touched after 'post'
+
+			run();
+			return false;
+		}
+
+		ReturnT await_resume()
+		{
+			if(m_exception)
+				std::rethrow_exception(m_exception);
+			return m_result.take();
+		}
+
+	private:
+		ExecutorT &m_executor;
+		detail::deferred_call<ReturnT(ParamsT...)> m_call;
+		detail::call_result<ReturnT> m_result;
+		std::exception_ptr m_exception;
+		std::coroutine_handle<> m_awaiting;
+
+		posted_call(const posted_call&);
+		void operator=(const posted_call&);
+
+		void run() noexcept
+		{
+			try
+			{
+				m_result.set(m_call);
+			}
+			catch(...)
+			{
+				m_exception = std::current_exception();
+			}
+		}
+
+		void run_and_resume()
+		{
+			run();
+			m_awaiting.resume();
+		}
+	};
+
+	template<class ExecutorT, class ReturnT, class... ParamsT, class... ArgsT>
+	inline posted_call<ExecutorT, ReturnT(ParamsT...)> call_on(ExecutorT &executor, const delegate<ReturnT(ParamsT...)> &call_to_post, ArgsT&&... args)
+	{
+		return posted_call<ExecutorT, ReturnT(ParamsT...)>(executor, call_to_post, std::forward<ArgsT>(args)...);
+	}
+}
+
+#endif // DELEGATES_CPLUSPLUS < 202002L
+
+#endif // POSTED_CALL_H
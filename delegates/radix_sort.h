@@ -0,0 +1,142 @@
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+//LSD radix sort for arrays of delegates: groups them by the code they call, then by object
+
+/******************************************************************************************************************************/
+/* 'delegates::radix_sort(first, last)' sorts 'delegate' or 'compact_delegate' (anything with 'sort_key()' and 'operator<')   */
+/* by 'delegate_sort_key' - code word first, then object word - one byte per pass, skipping passes where all keys have the    */
+/* same byte (usually most of the high bytes of pointers). Delegates with equal keys are then ordered with 'operator<', so    */
+/* the result is the same as 'std::sort(first, last)'.                                                                        */
+/* Keys with indices are sorted in a separate buffer (2 * (sizeof(delegate_sort_key) + sizeof(size_t)) bytes per delegate),   */
+/* then delegates are gathered into a sorted copy and copied back, so each one is copied exactly twice.                       */
+/*                                                                                                                            */
+/******************************************************************************************************************************/
+
+#include "delegate.h"
+
+#include <vector>
+#include <memory>
+#include <iterator>
+#include <algorithm>
+
+namespace delegates
+{
+	namespace detail
+	{
+		struct radix_sort_entry
+		{
+			delegate_sort_key key;
+			std::size_t index;
+		};
+
+		// uninitialized storage for the entries, all of them are written before being read
+		struct radix_sort_buffer
+		{
+			explicit radix_sort_buffer(std::size_t count)
+				: data(std::allocator<radix_sort_entry>().allocate(count)),
+				count(count)
+			{ }
+
+			~radix_sort_buffer()
+			{
+				std::allocator<radix_sort_entry>().deallocate(data, count);
+			}
+
+			radix_sort_entry *data;
+			std::size_t count;
+
+		private:
+			radix_sort_buffer(const radix_sort_buffer&);
+			void operator=(const radix_sort_buffer&);
+		};
+
+		static const unsigned radix_sort_passes = 2 * sizeof(std::size_t);
+
+		// byte of the key for the pass, object word bytes go first (least significant)
+		inline std::size_t radix_sort_digit(const delegate_sort_key &key, unsigned pass)
+		{
+			const std::size_t word = (pass < sizeof(std::size_t)) ? key.object : key.code;
+			return (word >> ((pass % sizeof(std::size_t)) * 8)) & 0xff;
+		}
+
+		// stable counting pass over one byte of the keys with already counted 'histogram' of this byte,
+		// returns false (and does nothing) if all keys have the same byte
+		inline bool radix_sort_pass(const radix_sort_entry *from, radix_sort_entry *to, std::size_t count,
+			unsigned pass, std::size_t *histogram)
+		{
+			if(histogram[radix_sort_digit(from[0].key, pass)] == count)
+				return false;
+
+			std::size_t offset = 0;
+			for(std::size_t digit = 0; digit < 256; ++digit)
+			{
+				const std::size_t digit_count = histogram[digit];
+				histogram[digit] = offset;
+				offset += digit_count;
+			}
+
+			for(std::size_t i = 0; i < count; ++i)
+				to[histogram[radix_sort_digit(from[i].key, pass)]++] = from[i];
+
+			return true;
+		}
+	}
+
+	template<class RandomAccessIteratorT>
+	void radix_sort(RandomAccessIteratorT first, RandomAccessIteratorT last)
+	{
+		typedef typename std::iterator_traits<RandomAccessIteratorT>::value_type value_type;
+
+		const std::size_t count = static_cast<std::size_t>(last - first);
+		if(count < 2)
+			return;
+
+		detail::radix_sort_buffer entries(count), buffer(count);
+		std::vector<std::size_t> histograms(detail::radix_sort_passes * 256);
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			entries.data[i].key = first[i].sort_key();
+			entries.data[i].index = i;
+			for(unsigned pass = 0; pass < detail::radix_sort_passes; ++pass)
+				++histograms[pass * 256 + detail::radix_sort_digit(entries.data[i].key, pass)];
+		}
+
+		detail::radix_sort_entry *from = entries.data, *to = buffer.data;
+		for(unsigned pass = 0; pass < detail::radix_sort_passes; ++pass)
+		{
+			if(detail::radix_sort_pass(from, to, count, pass, &histograms[pass * 256]))
+				std::swap(from, to);
+		}
+
+		// gathered into a copy: independent loads are much faster than following the permutation cycles in place
+		{
+			std::vector<value_type> sorted;
+			sorted.reserve(count);
+			for(std::size_t i = 0; i < count; ++i)
+				sorted.push_back(first[from[i].index]);
+			std::copy(sorted.begin(), sorted.end(), first);
+		}
+
+		// equal keys are still ordered by 'operator<' (usually they are equal delegates and nothing is done)
+		for(std::size_t begin = 0, end = 1; end <= count; ++end)
+		{
+			if(end < count && from[end].key == from[begin].key)
+				continue;
+			for(std::size_t i = begin + 1; i < end; ++i)
+			{
+				if(!(first[i] == first[i - 1]) && first[i] < first[i - 1])
+				{
+					std::sort(first + begin, first + end);
+					break;
+				}
+			}
+			begin = end;
+		}
+	}
+}
+
+#endif // RADIX_SORT_H
@@ -0,0 +1,221 @@
+#ifndef REACTOR_H
+#define REACTOR_H
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+//epoll reactor: readiness of each file descriptor is dispatched to its delegate, looked up by the descriptor in a flat table
+
+/******************************************************************************************************************************/
+/* 'delegates::reactor' calls 'delegate<void(int fd, uint32_t events)>' registered for a file descriptor when epoll reports   */
+/* it ready (Linux only):                                                                                                     */
+/*                                                                                                                            */
+/*   reactor loop;                                                                                                            */
+/*                                                                                                                            */
+/*   loop.add(socket_fd, delegate<void(int, uint32_t)>(&connection, &Connection::on_ready)); // EPOLLIN | EPOLLET by default  */
+/*   while(running)                                                                                                           */
+/*       loop.run_once(timeout_ms); // one 'epoll_wait', calls the handlers of the ready descriptors                          */
+/*                                                                                                                            */
+/* Handlers are kept in an array indexed by the descriptor, so dispatch is an index and a call: no search, no allocation.     */
+/* Registration is edge-triggered unless other events are given, so the handler must read (write) until EAGAIN. Events are    */
+/* taken in batches of up to 'max_events' per 'epoll_wait'. Each registration has a generation number carried in the epoll    */
+/* data: handler could remove (and close) any descriptor, itself included, and add descriptors - events of the same batch     */
+/* that were reported for a removed registration are dropped. Remove the descriptor before closing it. Not thread safe.       */
+/* Requires C++11.                                                                                                            */
+/*                                                                                                                            */
+/******************************************************************************************************************************/
+
+#include "delegate.h"
+
+#if DELEGATES_CPLUSPLUS < 201103L
+#error "reactor requires C++11"
+#elif !defined(__linux__)
+#error "reactor requires Linux (epoll)"
+#else
+
+#include <vector>
+#include <cstdint>
+#include <cerrno>
+#include <system_error>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+namespace delegates
+{
+	class reactor
+	{
+	public:
+		typedef reactor type;
+		typedef delegate<void(int, std::uint32_t)> delegate_type;
+
+		// throws 'std::system_error' if the epoll instance could not be created
+		explicit reactor(std::size_t max_events = 256)
+			: m_epoll(epoll_create1(EPOLL_CLOEXEC)),
+			m_events(max_events ? max_events : 1),
+			m_size(0)
+		{
+			if(m_epoll < 0)
+				throw std::system_error(errno, std::system_category(), "epoll_create1");
+		}
+
+		~reactor()
+		{
+			close(m_epoll);
+		}
+
+		// false (with errno set) if the descriptor is registered already or 'epoll_ctl' fails
+		bool add(int fd, const delegate_type &handler, std::uint32_t events = EPOLLIN | EPOLLET)
+		{
+			if(fd < 0 || handler.empty())
+			{
+				errno = EINVAL;
+				return false;
+			}
+			if(contains(fd))
+			{
+				errno = EEXIST;
+				return false;
+			}
+
+			if(static_cast<std::size_t>(fd) >= m_handlers.size())
+				m_handlers.resize(static_cast<std::size_t>(fd) + 1 > 2 * m_handlers.size() ? static_cast<std::size_t>(fd) + 1 : 2 * m_handlers.size());
+
+			registration &added = m_handlers[fd];
+			if(!control(EPOLL_CTL_ADD, fd, events, added.generation + 1))
+				return false;
+
+			++added.generation;
+			added.handler = handler;
+			++m_size;
+			return true;
+		}
+
+		// changes the events the descriptor is watched for
+		bool modify(int fd, std::uint32_t events)
+		{
+			if(!contains(fd))
+			{
+				errno = ENOENT;
+				return false;
+			}
+			return control(EPOLL_CTL_MOD, fd, events, m_handlers[fd].generation);
+		}
+
+		// changes the handler, takes effect for the events not dispatched yet
+		bool modify(int fd, const delegate_type &handler)
+		{
+			if(!contains(fd))
+			{
+				errno = ENOENT;
+				return false;
+			}
+			if(handler.empty())
+			{
+				errno = EINVAL;
+				return false;
+			}
+			m_handlers[fd].handler = handler;
+			return true;
+		}
+
+		bool remove(int fd)
+		{
+			if(!contains(fd))
+			{
+				errno = ENOENT;
+				return false;
+			}
+
+			registration &removed = m_handlers[fd];
+			removed.handler.clear();
+			++removed.generation; // events already taken from epoll for this registration are dropped
+			--m_size;
+			return 0 == epoll_ctl(m_epoll, EPOLL_CTL_DEL, fd, NULL);
+		}
+
+		inline bool contains(int fd) const
+		{
+			return fd >= 0 && static_cast<std::size_t>(fd) < m_handlers.size() && !m_handlers[fd].handler.empty();
+		}
+
+		// waits up to 'timeout_ms' (-1 forever) for one batch of events and dispatches it;
+		// returns the number of events taken from epoll, -1 (with errno set) on error, 0 on timeout or EINTR
+		int run_once(int timeout_ms)
+		{
+			const int count = epoll_wait(m_epoll, m_events.data(), static_cast<int>(m_events.size()), timeout_ms);
+			if(count < 0)
+				return EINTR == errno ? 0 : -1;
+
+			for(int i = 0; i < count; ++i)
+			{
+				const std::uint64_t data = m_events[i].data.u64;
+				const int fd = static_cast<int>(data & 0xffffffff);
+				const std::uint32_t generation = static_cast<std::uint32_t>(data >> 32);
+				const std::uint32_t events = m_events[i].events; // 'epoll_event' is packed on x86-64
+
+				// the handler could remove this registration or grow the table, so the delegate is copied
+				const registration &ready = m_handlers[fd];
+				if(ready.generation == generation && !ready.handler.empty())
+				{
+					const delegate_type handler = ready.handler;
+					handler(fd, events);
+				}
+			}
+			return count;
+		}
+
+		// registered descriptors
+		inline std::size_t size() const
+		{
+			return m_size;
+		}
+
+		inline bool empty() const
+		{
+			return 0 == m_size;
+		}
+
+		// the table is indexed by the descriptor, so 'max_fd' is the greatest descriptor expected
+		void reserve(int max_fd)
+		{
+			if(max_fd >= 0 && static_cast<std::size_t>(max_fd) >= m_handlers.size())
+				m_handlers.resize(static_cast<std::size_t>(max_fd) + 1);
+		}
+
+		inline int native_handle() const
+		{
+			return m_epoll;
+		}
+
+	private:
+		struct registration
+		{
+			registration()
+				: generation(0)
+			{ }
+
+			delegate_type handler; // empty if the descriptor is not registered
+			std::uint32_t generation; // changes with every add and remove
+		};
+
+		int m_epoll;
+		std::vector<epoll_event> m_events;
+		std::vector<registration> m_handlers; // indexed by descriptor
+		std::size_t m_size;
+
+		reactor(const reactor&);
+		void operator=(const reactor&);
+
+		bool control(int operation, int fd, std::uint32_t events, std::uint32_t generation)
+		{
+			epoll_event event;
+			event.events = events;
+			event.data.u64 = static_cast<std::uint64_t>(static_cast<std::uint32_t>(fd)) | (static_cast<std::uint64_t>(generation) << 32);
+			return 0 == epoll_ctl(m_epoll, operation, fd, &event);
+		}
+	};
+}
+
+#endif // DELEGATES_CPLUSPLUS < 201103L
+
+#endif // REACTOR_H
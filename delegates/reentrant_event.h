@@ -0,0 +1,215 @@
+#ifndef REENTRANT_EVENT_H
+#define REENTRANT_EVENT_H
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+//multicast delegate that subscribers could modify while it is being called, without copying the subscribers per call
+
+/******************************************************************************************************************************/
+/* 'delegates::reentrant_event<return_type(param_type1, param_type2)>' holds 'delegate<return_type(param_type1, ...)>'        */
+/* subscribers, called in the order they were added. Subscribers could add and remove subscribers (themselves included) and   */
+/* call the event again while it is being called:                                                                             */
+/*                                                                                                                            */
+/*   1) subscriber removed during the call is not called anymore, even if its turn has not come yet in this call;             */
+/*   2) subscriber added during the call is not called until the outermost call returns, then it is appended to the others.   */
+/*                                                                                                                            */
+/* Removed subscribers are only cleared in place (tombstones) and added ones are kept in the pending list while the event is  */
+/* being called; both are applied when the outermost call returns. The lists keep their capacity, so once they have grown     */
+/* calls do not allocate. Not thread safe.                                                                                    */
+/* Requires C++11.                                                                                                            */
+/*                                                                                                                            */
+/******************************************************************************************************************************/
+
+#include "delegate.h"
+
+#if DELEGATES_CPLUSPLUS < 201103L
+#error "reentrant_event requires C++11"
+#else
+
+#include <vector>
+#include <algorithm>
+
+namespace delegates
+{
+	template<class SignatureT>
+	class reentrant_event;
+
+	template<class ReturnT, class... ParamsT>
+	class reentrant_event<ReturnT(ParamsT...)>
+	{
+	public:
+		typedef reentrant_event type;
+		typedef delegate<ReturnT(ParamsT...)> delegate_type;
+
+		reentrant_event()
+			: m_depth(0),
+			m_tombstones(0)
+		{ }
+
+		void add(const delegate_type &subscriber)
+		{
+			if(subscriber.empty())
+				return;
+
+			if(m_depth)
+				m_pending.push_back(subscriber);
+			else
+				m_subscribers.push_back(subscriber);
+		}
+
+		// removes the last subscriber equal to the given one
+		bool remove(const delegate_type &subscriber)
+		{
+			if(subscriber.empty())
+				return false;
+
+			for(std::size_t i = m_pending.size(); i-- > 0;)
+			{
+				if(m_pending[i] == subscriber)
+				{
+					m_pending.erase(m_pending.begin() + i);
+					return true;
+				}
+			}
+
+			for(std::size_t i = m_subscribers.size(); i-- > 0;)
+			{
+				if(m_subscribers[i] == subscriber)
+				{
+					if(m_depth)
+					{
+						m_subscribers[i].clear();
+						++m_tombstones;
+					}
+					else
+						m_subscribers.erase(m_subscribers.begin() + i);
+					return true;
+				}
+			}
+			return false;
+		}
+
+		bool contains(const delegate_type &subscriber) const
+		{
+			if(subscriber.empty())
+				return false;
+			return std::find(m_subscribers.begin(), m_subscribers.end(), subscriber) != m_subscribers.end() ||
+				std::find(m_pending.begin(), m_pending.end(), subscriber) != m_pending.end();
+		}
+
+		reentrant_event& operator+=(const delegate_type &subscriber)
+		{
+			add(subscriber);
+			return *this;
+		}
+
+		reentrant_event& operator-=(const delegate_type &subscriber)
+		{
+			remove(subscriber);
+			return *this;
+		}
+
+		template<class... ArgsT>
+		void operator()(ArgsT&&... args)
+		{
+			call_guard guard(*this);
+
+			// the array is neither reallocated nor shrunk until the outermost call returns
+			const std::size_t count = m_subscribers.size();
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				const delegate_type &subscriber = m_subscribers[i];
+				if(!subscriber.empty())
+					subscriber(args...);
+			}
+		}
+
+		// subscribers that are going to be called (the ones added during the call included)
+		std::size_t size() const
+		{
+			return m_subscribers.size() - m_tombstones + m_pending.size();
+		}
+
+		bool empty() const
+		{
+			return 0 == size();
+		}
+
+		void reserve(std::size_t count)
+		{
+			if(0 == m_depth) // the array must not be reallocated during the call
+				m_subscribers.reserve(count);
+		}
+
+		void clear()
+		{
+			m_pending.clear();
+			if(m_depth)
+			{
+				for(std::size_t i = 0; i < m_subscribers.size(); ++i)
+					m_subscribers[i].clear();
+				m_tombstones = m_subscribers.size();
+			}
+			else
+				m_subscribers.clear();
+		}
+
+	private:
+		std::vector<delegate_type> m_subscribers; // empty delegates are tombstones of removed ones
+		std::vector<delegate_type> m_pending; // added during the call
+		unsigned m_depth;
+		std::size_t m_tombstones;
+
+		reentrant_event(const reentrant_event&);
+		void operator=(const reentrant_event&);
+
+		struct call_guard
+		{
+			explicit call_guard(reentrant_event &event)
+				: event(event)
+			{
+				++event.m_depth;
+			}
+
+			~call_guard()
+			{
+				if(0 == --event.m_depth)
+					event.apply_changes();
+			}
+
+			reentrant_event &event;
+		};
+
+		void apply_changes()
+		{
+			if(m_tombstones)
+			{
+				m_subscribers.erase(
+					std::remove_if(m_subscribers.begin(), m_subscribers.end(), is_tombstone), m_subscribers.end());
+				m_tombstones = 0;
+			}
+			if(!m_pending.empty())
+			{
+				try
+				{
+					m_subscribers.insert(m_subscribers.end(), m_pending.begin(), m_pending.end());
+					m_pending.clear();
+				}
+				catch(...)
+				{
+					// out of memory: the pending subscribers stay pending until the next call returns
+				}
+			}
+		}
+
+		static bool is_tombstone(const delegate_type &subscriber)
+		{
+			return subscriber.empty();
+		}
+	};
+}
+
+#endif // DELEGATES_CPLUSPLUS < 201103L
+
+#endif // REENTRANT_EVENT_H
@@ -0,0 +1,200 @@
+#ifndef SLOT_EVENT_H
+#define SLOT_EVENT_H
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+//multicast delegate with subscription handles: O(1) unsubscribe by handle, subscribers stay densely packed
+
+/******************************************************************************************************************************/
+/* 'delegates::slot_event<return_type(param_type1, param_type2)>' holds 'compact_delegate<return_type, ...>'                  */
+/* subscribers; 'subscribe' returns a handle that is used to unsubscribe:                                                     */
+/*                                                                                                                            */
+/*   slot_event<void(int)> on_value;                                                                                          */
+/*                                                                                                                            */
+/*   slot_event<void(int)>::handle subscription = on_value.subscribe(compact_delegate<void, int>(&obj, &Object::set));        */
+/*   on_value(42);                                                                                                            */
+/*   on_value.unsubscribe(subscription); // O(1), no search                                                                   */
+/*                                                                                                                            */
+/* Subscribers are kept in one dense array, unsubscribing moves the last subscriber into the freed place, so the order of the */
+/* calls is not the order of subscribing. A handle names a slot and its generation: the generation changes when the slot is   */
+/* freed, so stale handles (unsubscribed already, or from before 'clear') are rejected by 'unsubscribe' and 'contains' in     */
+/* O(1). Slots freed 2^31 times could give a stale handle a false match.                                                      */
+/* Subscribers must not subscribe or unsubscribe while the event is being called.                                             */
+/* Requires C++11.                                                                                                            */
+/*                                                                                                                            */
+/******************************************************************************************************************************/
+
+#include "compact_delegate.h"
+
+#if DELEGATES_CPLUSPLUS < 201103L
+#error "slot_event requires C++11"
+#else
+
+#include <vector>
+#include <cstdint>
+
+namespace delegates
+{
+	template<class SignatureT>
+	class slot_event;
+
+	template<class ReturnT, class... ParamsT>
+	class slot_event<ReturnT(ParamsT...)>
+	{
+	public:
+		typedef slot_event type;
+		typedef compact_delegate<ReturnT, ParamsT...> delegate_type;
+
+		struct handle
+		{
+			handle()
+				: slot(0),
+				generation(0) // even generation never names a live slot
+			{ }
+
+			bool operator==(const handle &other) const
+			{
+				return slot == other.slot && generation == other.generation;
+			}
+
+			bool operator!=(const handle &other) const
+			{
+				return !(*this == other);
+			}
+
+			std::uint32_t slot;
+			std::uint32_t generation;
+		};
+
+		slot_event()
+			: m_free_slot(no_slot)
+		{ }
+
+		handle subscribe(const delegate_type &subscriber)
+		{
+			handle result;
+			if(subscriber.empty())
+				return result;
+
+			if(m_delegates.size() == m_delegates.capacity())
+				m_delegates.reserve(2 * m_delegates.size() + 1);
+			m_dense_slots.reserve(m_delegates.capacity());
+			if(no_slot == m_free_slot)
+			{
+				slot added;
+				added.index = no_slot;
+				added.generation = 0;
+				m_slots.push_back(added);
+				m_free_slot = static_cast<std::uint32_t>(m_slots.size() - 1);
+			}
+
+			// nothing below throws
+			const std::uint32_t slot_index = m_free_slot;
+			slot &subscribed = m_slots[slot_index];
+			m_free_slot = subscribed.index;
+			subscribed.index = static_cast<std::uint32_t>(m_delegates.size());
+			++subscribed.generation; // odd - live
+			m_delegates.push_back(subscriber);
+			m_dense_slots.push_back(slot_index);
+
+			result.slot = slot_index;
+			result.generation = subscribed.generation;
+			return result;
+		}
+
+		bool unsubscribe(const handle &subscription)
+		{
+			if(!contains(subscription))
+				return false;
+
+			slot &unsubscribed = m_slots[subscription.slot];
+			const std::uint32_t index = unsubscribed.index;
+			const std::uint32_t last = static_cast<std::uint32_t>(m_delegates.size() - 1);
+			if(index != last)
+			{
+				m_delegates[index] = m_delegates[last];
+				m_dense_slots[index] = m_dense_slots[last];
+				m_slots[m_dense_slots[index]].index = index;
+			}
+			m_delegates.pop_back();
+			m_dense_slots.pop_back();
+
+			++unsubscribed.generation; // even - free
+			unsubscribed.index = m_free_slot;
+			m_free_slot = subscription.slot;
+			return true;
+		}
+
+		inline bool contains(const handle &subscription) const
+		{
+			return subscription.slot < m_slots.size() && m_slots[subscription.slot].generation == subscription.generation &&
+				(subscription.generation & 1) != 0;
+		}
+
+		// NULL for stale handle
+		const delegate_type* get(const handle &subscription) const
+		{
+			return contains(subscription) ? &m_delegates[m_slots[subscription.slot].index] : NULL;
+		}
+
+		template<class... ArgsT>
+		void operator()(ArgsT&&... args) const
+		{
+			const delegate_type *subscribers = m_delegates.data();
+			const std::size_t count = m_delegates.size();
+
+			for(std::size_t i = 0; i < count; ++i)
+				subscribers[i](args...);
+		}
+
+		inline std::size_t size() const
+		{
+			return m_delegates.size();
+		}
+
+		inline bool empty() const
+		{
+			return m_delegates.empty();
+		}
+
+		void reserve(std::size_t count)
+		{
+			m_delegates.reserve(count);
+			m_dense_slots.reserve(count);
+			m_slots.reserve(count);
+		}
+
+		// all handles become stale
+		void clear()
+		{
+			for(std::size_t i = 0; i < m_dense_slots.size(); ++i)
+			{
+				slot &unsubscribed = m_slots[m_dense_slots[i]];
+				++unsubscribed.generation;
+				unsubscribed.index = m_free_slot;
+				m_free_slot = m_dense_slots[i];
+			}
+			m_delegates.clear();
+			m_dense_slots.clear();
+		}
+
+	private:
+		static const std::uint32_t no_slot = 0xffffffff;
+
+		struct slot
+		{
+			std::uint32_t index; // in 'm_delegates' for live slot, next free slot for free one
+			std::uint32_t generation; // odd for live slot
+		};
+
+		std::vector<delegate_type> m_delegates; // dense, called in this order
+		std::vector<std::uint32_t> m_dense_slots; // slot of each delegate in 'm_delegates'
+		std::vector<slot> m_slots;
+		std::uint32_t m_free_slot;
+	};
+}
+
+#endif // DELEGATES_CPLUSPLUS < 201103L
+
+#endif // SLOT_EVENT_H
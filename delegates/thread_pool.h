@@ -0,0 +1,405 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+//work-stealing thread pool running delegates with their arguments, posting a task does not allocate
+
+/******************************************************************************************************************************/
+/* 'delegates::thread_pool<void(param_type1, param_type2)>' runs tasks - 'delegate<void(param_type1, ...)>' together with     */
+/* copies of the arguments (no arguments by default), stored inline in the task:                                              */
+/*                                                                                                                            */
+/*   thread_pool<void(Chunk*)> pool; // one worker per hardware thread                                                        */
+/*                                                                                                                            */
+/*   pool.post(delegate<void(Chunk*)>(&renderer, &Renderer::render), &chunks[i]); // false if the queues are full             */
+/*                                                                                                                            */
+/* Each worker has a bounded Chase-Lev deque: tasks posted by a task go to the deque of its worker (last in, first out),      */
+/* tasks posted by other threads go to the shared queue under a mutex. Idle worker steals from the top of the deque of a      */
+/* random worker, then spins for a while and parks on a condition variable; posting wakes a parked worker if there is one.    */
+/* Queues are allocated by the constructor, so posting copies the delegate and the arguments into a slot and never            */
+/* allocates. 'post' returns false when both the deque of the calling worker (if any) and the shared queue are full.          */
+/* The destructor runs the tasks that are still queued, then joins the workers. Tasks must not throw.                         */
+/* Requires C++11.                                                                                                            */
+/*                                                                                                                            */
+/******************************************************************************************************************************/
+
+#include "deferred_call.h"
+
+#if DELEGATES_CPLUSPLUS < 201103L
+#error "thread_pool requires C++11"
+#else
+
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+namespace delegates
+{
+	namespace detail
+	{
+		// bounded Chase-Lev deque: the owner pushes and pops at the bottom, thieves steal from the top.
+		// A task is moved out of its slot after the slot is claimed; 'full' keeps the owner from reusing
+		// the slot until the thief that claimed it has moved the task out.
+		template<class TaskT>
+		class work_stealing_deque
+		{
+		public:
+			explicit work_stealing_deque(std::size_t capacity)
+				: m_top(0),
+				m_bottom(0),
+				m_slots(round_up_to_power_of_2(capacity)),
+				m_mask(static_cast<std::int64_t>(m_slots.size() - 1))
+			{ }
+
+			~work_stealing_deque()
+			{
+				for(std::size_t i = 0; i < m_slots.size(); ++i)
+					if(m_slots[i].full.load(std::memory_order_relaxed))
+						m_slots[i].task.get().~TaskT();
+			}
+
+			// owner only, moves the task from 'from' on success
+			bool push(call_storage<TaskT> &from)
+			{
+				const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+				const std::int64_t top = m_top.load(std::memory_order_acquire);
+				if(bottom - top > m_mask)
+					return false;
+
+				slot &pushed = m_slots[static_cast<std::size_t>(bottom & m_mask)];
+				if(pushed.full.load(std::memory_order_acquire)) // the thief is still moving the task out
+					return false;
+
+				from.move_to(pushed.task);
+				pushed.full.store(true, std::memory_order_relaxed);
+				m_bottom.store(bottom + 1, std::memory_order_release);
+				return true;
+			}
+
+			// owner only, the last pushed task
+			bool pop(call_storage<TaskT> &to)
+			{
+				const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+				m_bottom.store(bottom, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				std::int64_t top = m_top.load(std::memory_order_relaxed);
+
+				if(top > bottom)
+				{
+					m_bottom.store(bottom + 1, std::memory_order_relaxed);
+					return false;
+				}
+				if(top == bottom) // the last task, thieves could be taking it too
+				{
+					const bool taken = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+					m_bottom.store(bottom + 1, std::memory_order_relaxed);
+					if(!taken)
+						return false;
+				}
+				take(m_slots[static_cast<std::size_t>(bottom & m_mask)], to);
+				return true;
+			}
+
+			// any thread, the first pushed task; false if empty or another thread took the task first
+			bool steal(call_storage<TaskT> &to)
+			{
+				std::int64_t top = m_top.load(std::memory_order_acquire);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				const std::int64_t bottom = m_bottom.load(std::memory_order_acquire);
+				if(top >= bottom)
+					return false;
+
+				if(!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					return false;
+				take(m_slots[static_cast<std::size_t>(top & m_mask)], to);
+				return true;
+			}
+
+		private:
+			struct slot
+			{
+				slot()
+					: full(false)
+				{ }
+
+				call_storage<TaskT> task;
+				std::atomic<bool> full;
+			};
+
+			char m_padding_before[64];
+			std::atomic<std::int64_t> m_top; // written by thieves
+			char m_padding_between[64];
+			std::atomic<std::int64_t> m_bottom; // written by the owner
+			std::vector<slot> m_slots;
+			const std::int64_t m_mask;
+			char m_padding_after[64];
+
+			work_stealing_deque(const work_stealing_deque&);
+			void operator=(const work_stealing_deque&);
+
+			static void take(slot &taken, call_storage<TaskT> &to)
+			{
+				taken.task.move_to(to);
+				taken.full.store(false, std::memory_order_release);
+			}
+
+			static std::size_t round_up_to_power_of_2(std::size_t capacity)
+			{
+				std::size_t result = 1;
+				while(result < capacity)
+					result <<= 1;
+				return result;
+			}
+		};
+	}
+
+	template<class SignatureT = void()>
+	class thread_pool;
+
+	template<class... ParamsT>
+	class thread_pool<void(ParamsT...)>
+	{
+	public:
+		typedef thread_pool type;
+		typedef delegate<void(ParamsT...)> delegate_type;
+
+		// 'worker_count' 0 is one worker per hardware thread; 'queue_capacity' is the capacity of each deque and of the shared queue
+		explicit thread_pool(std::size_t worker_count = 0, std::size_t queue_capacity = 4096)
+			: m_shared_tasks(queue_capacity ? queue_capacity : 1),
+			m_shared_first(0),
+			m_shared_count(0),
+			m_shared_hint(0),
+			m_sleeping(0),
+			m_wake_epoch(0),
+			m_stopping(false)
+		{
+			if(0 == worker_count)
+				worker_count = std::thread::hardware_concurrency();
+			if(0 == worker_count)
+				worker_count = 1;
+
+			m_workers.reserve(worker_count);
+			for(std::size_t i = 0; i < worker_count; ++i)
+				m_workers.push_back(std::unique_ptr<worker>(new worker(*this, queue_capacity, static_cast<std::uint32_t>(i))));
+
+			try
+			{
+				for(std::size_t i = 0; i < worker_count; ++i)
+					m_workers[i]->thread = std::thread(&thread_pool::run_worker, this, i);
+			}
+			catch(...)
+			{
+				stop();
+				throw;
+			}
+		}
+
+		~thread_pool()
+		{
+			stop();
+		}
+
+		// 'args' are copied (moved) into the task and moved into the call
+		template<class... ArgsT>
+		bool post(const delegate_type &task_to_run, ArgsT&&... args)
+		{
+			if(task_to_run.empty())
+				return false;
+
+			detail::call_storage<task_type> posted;
+			new(&posted.bytes) task_type(task_to_run, std::forward<ArgsT>(args)...);
+
+			worker *current = current_worker();
+			if(!(current && &current->pool == this && current->tasks.push(posted)) && !push_shared(posted))
+			{
+				posted.get().~task_type();
+				return false;
+			}
+
+			// either the parked worker sees the task or this thread sees it parking
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if(m_sleeping.load(std::memory_order_relaxed))
+				wake_one();
+			return true;
+		}
+
+		inline std::size_t worker_count() const
+		{
+			return m_workers.size();
+		}
+
+	private:
+		typedef detail::deferred_call<void(ParamsT...)> task_type;
+
+		static const unsigned spin_count = 64; // rounds of looking for work before parking
+
+		struct worker
+		{
+			worker(thread_pool &pool, std::size_t queue_capacity, std::uint32_t index)
+				: pool(pool),
+				tasks(queue_capacity),
+				random_state(2654435761u * (index + 1))
+			{ }
+
+			thread_pool &pool;
+			detail::work_stealing_deque<task_type> tasks;
+			std::uint32_t random_state; // xorshift, picks the first victim to steal from
+			std::thread thread;
+		};
+
+		std::vector<std::unique_ptr<worker> > m_workers;
+
+		// tasks posted by threads that are not workers, ring buffer guarded by 'm_shared_mutex'
+		std::mutex m_shared_mutex;
+		std::vector<detail::call_storage<task_type> > m_shared_tasks;
+		std::size_t m_shared_first;
+		std::size_t m_shared_count;
+		std::atomic<std::size_t> m_shared_hint; // 'm_shared_count' readable without the lock
+
+		std::mutex m_sleep_mutex;
+		std::condition_variable m_wake;
+		std::atomic<unsigned> m_sleeping;
+		std::atomic<unsigned> m_wake_epoch; // changes on every wake, parking worker waits for it to change
+		std::atomic<bool> m_stopping;
+
+		thread_pool(const thread_pool&);
+		void operator=(const thread_pool&);
+
+		static worker*& current_worker()
+		{
+			static thread_local worker *current = NULL;
+			return current;
+		}
+
+		bool push_shared(detail::call_storage<task_type> &from)
+		{
+			std::lock_guard<std::mutex> lock(m_shared_mutex);
+			if(m_shared_count == m_shared_tasks.size())
+				return false;
+
+			from.move_to(m_shared_tasks[(m_shared_first + m_shared_count) % m_shared_tasks.size()]);
+			m_shared_hint.store(++m_shared_count, std::memory_order_relaxed);
+			return true;
+		}
+
+		bool pop_shared(detail::call_storage<task_type> &to)
+		{
+			if(0 == m_shared_hint.load(std::memory_order_relaxed))
+				return false;
+
+			std::lock_guard<std::mutex> lock(m_shared_mutex);
+			if(0 == m_shared_count)
+				return false;
+
+			m_shared_tasks[m_shared_first].move_to(to);
+			m_shared_first = (m_shared_first + 1) % m_shared_tasks.size();
+			m_shared_hint.store(--m_shared_count, std::memory_order_relaxed);
+			return true;
+		}
+
+		bool find_task(worker &self, detail::call_storage<task_type> &to)
+		{
+			if(self.tasks.pop(to) || pop_shared(to))
+				return true;
+
+			const std::size_t count = m_workers.size();
+			self.random_state ^= self.random_state << 13;
+			self.random_state ^= self.random_state >> 17;
+			self.random_state ^= self.random_state << 5;
+			const std::size_t first = self.random_state % count;
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				worker &victim = *m_workers[(first + i) % count];
+				if(&victim != &self && victim.tasks.steal(to))
+					return true;
+			}
+			return false;
+		}
+
+		void run_worker(std::size_t index)
+		{
+			worker &self = *m_workers[index];
+			current_worker() = &self;
+
+			detail::call_storage<task_type> found;
+			for(;;)
+			{
+				bool has_task = false;
+				for(unsigned spin = 0; spin < spin_count && !has_task; ++spin)
+				{
+					has_task = find_task(self, found);
+					if(!has_task)
+						std::this_thread::yield();
+				}
+
+				if(!has_task)
+				{
+					m_sleeping.fetch_add(1, std::memory_order_seq_cst);
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+					const unsigned epoch = m_wake_epoch.load(std::memory_order_seq_cst);
+					const bool stopping = m_stopping.load(std::memory_order_seq_cst); // read before the last look for a task
+
+					has_task = find_task(self, found);
+					if(!has_task && stopping)
+					{
+						// nothing left to run: tasks posted by the tasks of other workers are run by those workers
+						m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+						break;
+					}
+					if(!has_task)
+					{
+						std::unique_lock<std::mutex> lock(m_sleep_mutex);
+						while(m_wake_epoch.load(std::memory_order_seq_cst) == epoch)
+							m_wake.wait(lock);
+					}
+					m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+				}
+
+				if(has_task) // otherwise woken up: look for a task again
+				{
+					found.get().run();
+					found.get().~task_type();
+				}
+			}
+			current_worker() = NULL;
+		}
+
+		void wake_one()
+		{
+			m_wake_epoch.fetch_add(1, std::memory_order_seq_cst);
+			std::lock_guard<std::mutex> lock(m_sleep_mutex); // the worker is either waiting or has not read the epoch yet
+			m_wake.notify_one();
+		}
+
+		// workers run the tasks that are still queued before they exit, this thread helps with the shared queue
+		void stop()
+		{
+			m_stopping.store(true, std::memory_order_seq_cst);
+			{
+				std::lock_guard<std::mutex> lock(m_sleep_mutex);
+				m_wake_epoch.fetch_add(1, std::memory_order_seq_cst);
+				m_wake.notify_all();
+			}
+
+			detail::call_storage<task_type> found;
+			while(pop_shared(found))
+			{
+				found.get().run();
+				found.get().~task_type();
+			}
+
+			for(std::size_t i = 0; i < m_workers.size(); ++i)
+				if(m_workers[i]->thread.joinable())
+					m_workers[i]->thread.join();
+		}
+	};
+}
+
+#endif // DELEGATES_CPLUSPLUS < 201103L
+
+#endif // THREAD_POOL_H
@@ -0,0 +1,347 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+//hierarchical timing wheel calling delegates when their timers expire: O(1) schedule and cancel, no allocation per timer
+
+/******************************************************************************************************************************/
+/* 'delegates::timer_wheel<void()>' (or 'timer_wheel<void(timer_id)>' to know which timer has expired) calls delegates when   */
+/* the time, given by the owner in ticks of any unit, reaches their expiry:                                                   */
+/*                                                                                                                            */
+/*   timer_wheel<void()> timers;                                                                                              */
+/*                                                                                                                            */
+/*   timer_id timeout = timers.schedule(5000, delegate<void()>(&connection, &Connection::on_timeout)); // in 5000 ticks       */
+/*   timers.cancel(timeout); // O(1), stale ids are rejected                                                                  */
+/*   timers.advance(elapsed_ticks); // calls the delegates of the timers that have expired, in the order of expiry            */
+/*                                                                                                                            */
+/* Timers are nodes of one array, linked into the slots of 11 wheels of 64 slots (6 bits of the expiry each). A timer is in   */
+/* the wheel of the highest 6 bits its expiry differs from the current time in, so scheduling and cancelling are list         */
+/* operations; when the time enters the slot of a higher wheel, its timers are moved down. Each wheel has a bitmap of the     */
+/* slots that are not empty, so 'advance' jumps to the next slot that has timers instead of stepping tick by tick, and calls  */
+/* the timers of a slot as one batch. Freed nodes are reused; the array grows only when more timers are pending than ever     */
+/* before ('reserve' allocates up front). Timer id names the node and its generation, like the handles of 'slot_event'.       */
+/* Delegates could schedule and cancel timers (themselves included) when called. Not thread safe.                             */
+/* Requires C++11.                                                                                                            */
+/*                                                                                                                            */
+/******************************************************************************************************************************/
+
+#include "delegate.h"
+
+#if DELEGATES_CPLUSPLUS < 201103L
+#error "timer_wheel requires C++11"
+#else
+
+#include <vector>
+#include <cstdint>
+
+namespace delegates
+{
+	struct timer_id
+	{
+		timer_id()
+			: index(0),
+			generation(0) // even generation never names a pending timer
+		{ }
+
+		bool operator==(const timer_id &other) const
+		{
+			return index == other.index && generation == other.generation;
+		}
+
+		bool operator!=(const timer_id &other) const
+		{
+			return !(*this == other);
+		}
+
+		std::uint32_t index;
+		std::uint32_t generation;
+	};
+
+	namespace detail
+	{
+		inline unsigned lowest_bit(std::uint64_t bits)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return static_cast<unsigned>(__builtin_ctzll(bits));
+#else
+			unsigned result = 0;
+			for(; !(bits & 1); bits >>= 1)
+				++result;
+			return result;
+#endif
+		}
+
+		inline unsigned highest_bit(std::uint64_t bits)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return 63 - static_cast<unsigned>(__builtin_clzll(bits));
+#else
+			unsigned result = 0;
+			while(bits >>= 1)
+				++result;
+			return result;
+#endif
+		}
+
+		inline void call_timer(const delegate<void()> &callback, const timer_id &)
+		{
+			callback();
+		}
+
+		inline void call_timer(const delegate<void(timer_id)> &callback, const timer_id &timer)
+		{
+			callback(timer);
+		}
+	}
+
+	template<class SignatureT = void()>
+	class timer_wheel
+	{
+	public:
+		typedef timer_wheel type;
+		typedef delegate<SignatureT> delegate_type;
+
+		explicit timer_wheel(std::uint64_t start_time = 0)
+			: m_free(no_timer),
+			m_size(0),
+			m_now(start_time)
+		{
+			for(unsigned i = 0; i < level_count * slot_count; ++i)
+				m_slots[i] = no_timer;
+			for(unsigned i = 0; i < level_count; ++i)
+				m_occupied[i] = 0;
+		}
+
+		// expires when the time passes 'now() + delay' (delay 0 is the next tick); empty id for empty delegate
+		timer_id schedule(std::uint64_t delay, const delegate_type &callback)
+		{
+			timer_id result;
+			if(callback.empty())
+				return result;
+
+			if(no_timer == m_free)
+			{
+				m_timers.push_back(timer());
+				m_timers.back().next = no_timer;
+				m_timers.back().generation = 0;
+				m_free = static_cast<std::uint32_t>(m_timers.size() - 1);
+			}
+
+			const std::uint32_t index = m_free;
+			timer &scheduled = m_timers[index];
+			m_free = scheduled.next;
+			++scheduled.generation; // odd - pending
+			scheduled.callback = callback;
+			if(0 == delay)
+				delay = 1;
+			scheduled.expiry = delay > max_time - m_now ? max_time : m_now + delay;
+			link(index);
+			++m_size;
+
+			result.index = index;
+			result.generation = scheduled.generation;
+			return result;
+		}
+
+		bool cancel(const timer_id &timer_to_cancel)
+		{
+			if(!contains(timer_to_cancel))
+				return false;
+
+			unlink(timer_to_cancel.index);
+			release(timer_to_cancel.index);
+			return true;
+		}
+
+		// true if the timer has neither expired nor been cancelled
+		inline bool contains(const timer_id &timer_to_find) const
+		{
+			return timer_to_find.index < m_timers.size() && m_timers[timer_to_find.index].generation == timer_to_find.generation &&
+				(timer_to_find.generation & 1) != 0;
+		}
+
+		// moves the time forward, calls the delegates of the timers that have expired, returns their number
+		std::size_t advance(std::uint64_t elapsed)
+		{
+			const std::uint64_t target = elapsed > max_time - m_now ? max_time : m_now + elapsed;
+			std::size_t count = 0;
+
+			std::uint64_t time;
+			unsigned level;
+			while(next_slot(time, level) && time <= target)
+			{
+				m_now = time;
+				// the time has entered the slot: its timers are moved down, the ones expiring now end up in the first wheel
+				for(; level > 0; --level)
+				{
+					const unsigned slot = level * slot_count + static_cast<unsigned>((m_now >> (level * level_bits)) & slot_mask);
+					if(m_occupied[level] & (std::uint64_t(1) << (slot & slot_mask)))
+						cascade(slot);
+				}
+				count += expire(static_cast<unsigned>(m_now & slot_mask));
+			}
+			m_now = target;
+			return count;
+		}
+
+		inline std::uint64_t now() const
+		{
+			return m_now;
+		}
+
+		// pending timers
+		inline std::size_t size() const
+		{
+			return m_size;
+		}
+
+		inline bool empty() const
+		{
+			return 0 == m_size;
+		}
+
+		void reserve(std::size_t count)
+		{
+			m_timers.reserve(count);
+		}
+
+		// cancels all timers
+		void clear()
+		{
+			for(unsigned slot = 0; slot < level_count * slot_count; ++slot)
+			{
+				while(no_timer != m_slots[slot])
+				{
+					const std::uint32_t index = m_slots[slot];
+					unlink(index);
+					release(index);
+				}
+			}
+		}
+
+	private:
+		static const unsigned level_bits = 6;
+		static const unsigned slot_count = 1 << level_bits;
+		static const std::uint64_t slot_mask = slot_count - 1;
+		static const unsigned level_count = (64 + level_bits - 1) / level_bits;
+		static const std::uint32_t no_timer = 0xffffffff;
+		static const std::uint64_t max_time = ~std::uint64_t(0);
+
+		struct timer
+		{
+			delegate_type callback;
+			std::uint64_t expiry;
+			std::uint32_t slot; // level * slot_count + slot index in the wheel of that level
+			std::uint32_t previous;
+			std::uint32_t next; // next free timer for free one
+			std::uint32_t generation; // odd for pending timer
+		};
+
+		std::vector<timer> m_timers;
+		std::uint32_t m_free;
+		std::size_t m_size;
+		std::uint64_t m_now;
+		std::uint32_t m_slots[level_count * slot_count]; // first timer of each slot
+		std::uint64_t m_occupied[level_count]; // bit per slot that is not empty
+
+		// the slot of the first wheel that has timers (or the slot of a higher wheel that is to be moved down) and its time
+		bool next_slot(std::uint64_t &time, unsigned &level) const
+		{
+			for(level = 0; level < level_count; ++level)
+			{
+				if(!m_occupied[level])
+					continue;
+
+				// timers of a higher wheel expire after all the timers of the lower ones
+				const unsigned shift = level * level_bits;
+				const unsigned current = static_cast<unsigned>((m_now >> shift) & slot_mask);
+				const unsigned first = detail::lowest_bit(m_occupied[level] & (~std::uint64_t(0) << current));
+				const unsigned wheel_shift = shift + level_bits;
+				const std::uint64_t wheel_start = wheel_shift < 64 ? (m_now >> wheel_shift) << wheel_shift : 0;
+				time = wheel_start + (std::uint64_t(first) << shift);
+				return true;
+			}
+			return false;
+		}
+
+		void link(std::uint32_t index)
+		{
+			timer &linked = m_timers[index];
+			const std::uint64_t difference = linked.expiry ^ m_now;
+			const unsigned level = difference ? detail::highest_bit(difference) / level_bits : 0;
+			const unsigned slot_index = static_cast<unsigned>((linked.expiry >> (level * level_bits)) & slot_mask);
+
+			linked.slot = level * slot_count + slot_index;
+			linked.previous = no_timer;
+			linked.next = m_slots[linked.slot];
+			if(no_timer != linked.next)
+				m_timers[linked.next].previous = index;
+			m_slots[linked.slot] = index;
+			m_occupied[level] |= std::uint64_t(1) << slot_index;
+		}
+
+		void unlink(std::uint32_t index)
+		{
+			timer &unlinked = m_timers[index];
+			if(no_timer != unlinked.previous)
+				m_timers[unlinked.previous].next = unlinked.next;
+			else
+			{
+				m_slots[unlinked.slot] = unlinked.next;
+				if(no_timer == unlinked.next)
+					m_occupied[unlinked.slot / slot_count] &= ~(std::uint64_t(1) << (unlinked.slot & slot_mask));
+			}
+			if(no_timer != unlinked.next)
+				m_timers[unlinked.next].previous = unlinked.previous;
+		}
+
+		void release(std::uint32_t index)
+		{
+			timer &released = m_timers[index];
+			++released.generation; // even - free
+			released.next = m_free;
+			m_free = index;
+			--m_size;
+		}
+
+		void cascade(unsigned slot)
+		{
+			std::uint32_t index = m_slots[slot];
+			m_slots[slot] = no_timer;
+			m_occupied[slot / slot_count] &= ~(std::uint64_t(1) << (slot & slot_mask));
+
+			while(no_timer != index)
+			{
+				const std::uint32_t next = m_timers[index].next;
+				link(index);
+				index = next;
+			}
+		}
+
+		// calls the timers of the first wheel slot; timers scheduled by the calls go to later slots
+		std::size_t expire(unsigned slot)
+		{
+			std::size_t count = 0;
+			while(no_timer != m_slots[slot])
+			{
+				const std::uint32_t index = m_slots[slot];
+				unlink(index);
+				release(index);
+
+				timer_id expired;
+				expired.index = index;
+				expired.generation = m_timers[index].generation - 1;
+				const delegate_type callback = m_timers[index].callback; // the node could be reused by the call
+				++count;
+				detail::call_timer(callback, expired);
+			}
+			return count;
+		}
+	};
+}
+
+#endif // DELEGATES_CPLUSPLUS < 201103L
+
+#endif // TIMER_WHEEL_H